@@ -0,0 +1,89 @@
+/*
+ *  collect.cxx
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <signal.h>
+#include <string.h>
+
+#include <iostream>
+
+#include <ers/ers.h>
+#include <ers/InputStream.h>
+
+/** \file collect.cxx
+  * Drains the shared memory ring, which is filled by the "shm" streams of the processes running on the
+  * current node, and reports the collected issues to the ERS streams configured for this utility.
+  * For example the following command writes the collected log messages and errors to two rotated files:
+  *
+  *	TDAQ_ERS_LOG="rfile(node.log,100M,10,86400)" TDAQ_ERS_ERROR="rfile(node-error.log,100M,10,86400)" ers_collect ers_node
+  *
+  * Each rfile path must be used by a single stream, which owns its rotation, so several severities can not
+  * share one file. The numbers of issues dropped by the producers and of the reclaimed slots of the ring are
+  * reported every minute if they have grown. The utility terminates on SIGINT or SIGTERM.
+  */
+
+namespace
+{
+    struct Forwarder : public ers::IssueReceiver
+    {
+	void receive( const ers::Issue & issue ) override
+	{
+	    ers::StreamManager::instance().report_issue( issue.severity().type, issue );
+	}
+    };
+}
+
+void print_description()
+{
+    std::cout << "Description:" << std::endl;
+    std::cout << "\tCollects issues from the shared memory ring filled by the ERS \"shm\" streams and" << std::endl;
+    std::cout << "\treports them to the ERS streams configured in the current shell." << std::endl;
+}
+
+void print_usage()
+{
+    std::cout << "Usage: ers_collect [-h]|[--help]|name [timeout [mode]]" << std::endl;
+    std::cout << "Options/Arguments:" << std::endl;
+    std::cout << "\t[-h]|[--help]\tprints this help screen." << std::endl;
+    std::cout << "\tname\t\tname of the shared memory segment." << std::endl;
+    std::cout << "\t[timeout]\ttime in milliseconds after which a slot abandoned by a producer before writing is skipped." << std::endl;
+    std::cout << "\t[mode]\t\toctal permissions of the segment if it is created, default is 0600." << std::endl;
+}
+
+int main( int argc, char** argv )
+{
+    if ( argc < 2 || !strcmp( argv[1], "--help" ) || !strcmp( argv[1], "-h" ) )
+    {
+	print_description();
+	print_usage();
+	return argc < 2;
+    }
+
+    // the signals are handled synchronously by the main thread, other threads must not receive them
+    sigset_t signals;
+    sigemptyset( &signals );
+    sigaddset( &signals, SIGINT );
+    sigaddset( &signals, SIGTERM );
+    pthread_sigmask( SIG_BLOCK, &signals, 0 );
+
+    Forwarder forwarder;
+    try
+    {
+	ers::StreamManager::instance().add_receiver( "shm",
+		{ argv[1], argc > 2 ? argv[2] : "1000", argc > 3 ? argv[3] : "0600" }, &forwarder );
+    }
+    catch( ers::Issue & ex )
+    {
+	ers::fatal( ex );
+	return 1;
+    }
+
+    int signal;
+    sigwait( &signals, &signal );
+
+    ers::StreamManager::instance().remove_receiver( &forwarder );
+    return 0;
+}
@@ -0,0 +1,282 @@
+/*
+ *  symbolize.cxx
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <elf.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cxxabi.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/** \file symbolize.cxx
+  * Resolves the module relative stack frames, which are printed by ERS if the TDAQ_ERS_RAW_STACK
+  * environment variable is set, into function names. The frames have the following format:
+  *
+  *	/path/to/module [build_id] +0xoffset
+  *
+  * The utility reads the ELF symbol tables of the modules and checks that the build id of each module
+  * matches the one, which is recorded in the frame.
+  */
+
+namespace
+{
+    struct Symbol
+    {
+	uint64_t	m_address;
+	uint64_t	m_size;
+	std::string	m_name;
+
+	bool operator<( const Symbol & other ) const
+	{ return m_address < other.m_address; }
+    };
+
+    class ElfFile
+    {
+      public:
+	explicit ElfFile( const std::string & path );
+
+	const std::string & build_id() const
+	{ return m_build_id; }
+
+	bool valid() const
+	{ return m_valid; }
+
+	const Symbol * find( uint64_t address ) const;
+
+      private:
+	void read_symbols( const char * data, size_t size, const Elf64_Shdr & table, const Elf64_Shdr & strings );
+	void read_build_id( const char * data, const Elf64_Shdr & notes );
+
+      private:
+	bool			m_valid;
+	std::string		m_build_id;
+	std::vector<Symbol>	m_symbols;
+    };
+
+    ElfFile::ElfFile( const std::string & path )
+      : m_valid( false )
+    {
+	int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+	if ( fd < 0 )
+	    return;
+
+	struct stat st;
+	if ( ::fstat( fd, &st ) || (size_t)st.st_size < sizeof( Elf64_Ehdr ) )
+	{
+	    ::close( fd );
+	    return;
+	}
+
+	size_t size = st.st_size;
+	void * map = ::mmap( 0, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	::close( fd );
+	if ( map == MAP_FAILED )
+	    return;
+
+	const char * data = static_cast<const char *>( map );
+	const Elf64_Ehdr * header = (const Elf64_Ehdr *)data;
+	if (	!::memcmp( header->e_ident, ELFMAG, SELFMAG )
+	     && header->e_ident[EI_CLASS] == ELFCLASS64
+	     && header->e_shoff + (size_t)header->e_shnum * sizeof( Elf64_Shdr ) <= size )
+	{
+	    const Elf64_Shdr * sections = (const Elf64_Shdr *)( data + header->e_shoff );
+	    bool has_symtab = false;
+	    for ( int i = 0; i < header->e_shnum; ++i )
+	    {
+		has_symtab |= ( sections[i].sh_type == SHT_SYMTAB );
+	    }
+
+	    for ( int i = 0; i < header->e_shnum; ++i )
+	    {
+		const Elf64_Shdr & section = sections[i];
+		if ( section.sh_type == SHT_NOTE )
+		{
+		    read_build_id( data, section );
+		}
+		else if (   ( section.sh_type == SHT_SYMTAB || ( !has_symtab && section.sh_type == SHT_DYNSYM ) )
+			  && section.sh_link < header->e_shnum )
+		{
+		    read_symbols( data, size, section, sections[section.sh_link] );
+		}
+	    }
+	    std::sort( m_symbols.begin(), m_symbols.end() );
+	    m_valid = true;
+	}
+
+	::munmap( map, size );
+    }
+
+    void
+    ElfFile::read_symbols( const char * data, size_t size, const Elf64_Shdr & table, const Elf64_Shdr & strings )
+    {
+	if ( table.sh_offset + table.sh_size > size || strings.sh_offset + strings.sh_size > size )
+	    return;
+
+	const Elf64_Sym * symbols = (const Elf64_Sym *)( data + table.sh_offset );
+	size_t count = table.sh_size / sizeof( Elf64_Sym );
+	for ( size_t i = 0; i < count; ++i )
+	{
+	    const Elf64_Sym & symbol = symbols[i];
+	    if (    ELF64_ST_TYPE( symbol.st_info ) == STT_FUNC
+		 && symbol.st_value && symbol.st_name < strings.sh_size )
+	    {
+		m_symbols.push_back( Symbol{ symbol.st_value, symbol.st_size,
+				 data + strings.sh_offset + symbol.st_name } );
+	    }
+	}
+    }
+
+    void
+    ElfFile::read_build_id( const char * data, const Elf64_Shdr & notes )
+    {
+	const char * note = data + notes.sh_offset;
+	const char * end = note + notes.sh_size;
+	while ( note + sizeof( Elf64_Nhdr ) <= end )
+	{
+	    const Elf64_Nhdr * header = (const Elf64_Nhdr *)note;
+	    const char * name = note + sizeof( Elf64_Nhdr );
+	    const char * desc = name + ( ( header->n_namesz + 3 ) & ~3 );
+	    if (    header->n_type == NT_GNU_BUILD_ID
+		 && header->n_namesz == 4 && !::memcmp( name, "GNU", 4 ) )
+	    {
+		std::ostringstream out;
+		for ( size_t i = 0; i < header->n_descsz; ++i )
+		{
+		    out << std::hex << ( ( (unsigned char)desc[i] ) >> 4 ) << ( desc[i] & 0xf );
+		}
+		m_build_id = out.str();
+		return;
+	    }
+	    note = desc + ( ( header->n_descsz + 3 ) & ~3 );
+	}
+    }
+
+    const Symbol *
+    ElfFile::find( uint64_t address ) const
+    {
+	auto it = std::upper_bound( m_symbols.begin(), m_symbols.end(), Symbol{ address, 0, std::string() } );
+	if ( it == m_symbols.begin() )
+	    return 0;
+	--it;
+	return ( address < it->m_address + std::max<uint64_t>( it->m_size, 1 ) ) ? &*it : 0;
+    }
+
+    std::string
+    demangle( const std::string & name )
+    {
+	int status;
+	char * demangled = abi::__cxa_demangle( name.c_str(), 0, 0, &status );
+	if ( !demangled )
+	    return name;
+
+	std::string result( demangled );
+	free( demangled );
+	return result;
+    }
+
+    std::string
+    resolve( const std::string & module, const std::string & build_id, uint64_t offset )
+    {
+	static std::map<std::string, std::unique_ptr<ElfFile> > files;
+
+	std::unique_ptr<ElfFile> & file = files[module];
+	if ( !file )
+	    file.reset( new ElfFile( module ) );
+
+	std::ostringstream out;
+	out << module;
+	if ( !file->valid() )
+	{
+	    out << " [can not read the file] +0x" << std::hex << offset;
+	}
+	else if ( !build_id.empty() && file->build_id() != build_id )
+	{
+	    out << " [build id mismatch] +0x" << std::hex << offset;
+	}
+	else if ( const Symbol * symbol = file->find( offset ) )
+	{
+	    out << "(" << demangle( symbol->m_name ) << "+0x" << std::hex << offset - symbol->m_address << ")"
+		<< " [+0x" << offset << "]";
+	}
+	else
+	{
+	    out << " [+0x" << std::hex << offset << "]";
+	}
+	return out.str();
+    }
+}
+
+void print_description()
+{
+    std::cout << "Description:" << std::endl;
+    std::cout << "\tResolves module relative stack frames printed by ERS into function names." << std::endl;
+    std::cout << "\tReads the given file or the standard input and writes the result to the standard output." << std::endl;
+}
+
+void print_usage()
+{
+    std::cout << "Usage: ers_symbolize [-h]|[--help]|[file]" << std::endl;
+    std::cout << "Options/Arguments:" << std::endl;
+    std::cout << "\t[-h]|[--help]\tprints this help screen." << std::endl;
+    std::cout << "\t[file]\t\tfile that contains ERS output, default is the standard input." << std::endl;
+}
+
+int main( int argc, char** argv )
+{
+    if ( argc > 1 && ( !strcmp( argv[1], "--help" ) || !strcmp( argv[1], "-h" ) ) )
+    {
+	print_description();
+	print_usage();
+	return 0;
+    }
+
+    std::ifstream file;
+    if ( argc > 1 )
+    {
+	file.open( argv[1] );
+	if ( !file )
+	{
+	    std::cerr << "Can not open the \"" << argv[1] << "\" file" << std::endl;
+	    return 1;
+	}
+    }
+    std::istream & in = argc > 1 ? file : std::cin;
+
+    const std::regex frame( "(\\S+) \\[([0-9a-f]*)\\] \\+0x([0-9a-f]+)" );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+	std::smatch match;
+	std::string::const_iterator begin = line.begin();
+	while ( std::regex_search( begin, line.cend(), match, frame ) )
+	{
+	    std::cout << std::string( begin, match[0].first );
+	    try {
+		std::cout << resolve( match[1], match[2], std::stoull( match[3], 0, 16 ) );
+	    }
+	    catch( std::exception & ) {
+		// the offset does not fit into an address, the record is printed unresolved
+		std::cout << match[0];
+	    }
+	    begin = match[0].second;
+	}
+	std::cout << std::string( begin, line.cend() ) << std::endl;
+    }
+    return 0;
+}
@@ -42,15 +42,25 @@ namespace ers
         
         ~AnyIssue() noexcept { ; }
         
+        AnyIssue( const AnyIssue & ) = default;
+
+        AnyIssue( AnyIssue && ) = default;
+
         virtual ers::Issue * clone() const
         { return new AnyIssue( *this ); }
 	
+        virtual ers::Issue * move_clone()
+        { return new AnyIssue( std::move( *this ) ); }
+	
         virtual const char * get_class_name() const
         { return m_type.c_str(); }
        	
         virtual void raise() const
         { throw AnyIssue(*this); }
         
+        virtual void move_raise()
+        { throw AnyIssue( std::move( *this ) ); }
+        
       private:
       	std::string m_type;
     };
@@ -0,0 +1,96 @@
+/*
+ *  Clock.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file Clock.h This file defines the clock sources, which can be used for the issue timestamps.
+  * \brief ers header and documentation file
+  */
+
+#ifndef ERS_CLOCK_H
+#define ERS_CLOCK_H
+
+#include <chrono>
+#include <string>
+
+#include <ers/Severity.h>
+
+namespace ers
+{
+    class BadClockSource;
+
+    /** Clock sources for the issue timestamps. The clock source can be selected for every severity
+      * with the TDAQ_ERS_CLOCK environment variable or with the ers::Configuration::clock function.
+      * \li RealtimeClock - the CLOCK_REALTIME clock, this is the default
+      * \li CoarseClock - the CLOCK_REALTIME_COARSE clock, which is much faster but has a resolution
+      *	    of a few milliseconds
+      * \li TscClock - the CPU time stamp counter, which is calibrated against CLOCK_MONOTONIC and anchored
+      *	    to CLOCK_REALTIME. The calibration takes 10 milliseconds when this clock is used for the first
+      *	    time. On platforms without invariant TSC this source falls back to RealtimeClock.
+      */
+    enum clock_source { RealtimeClock, CoarseClock, TscClock };
+
+    clock_source	parse( const std::string & s, clock_source & );	/**< \brief accepts "realtime", "coarse" and "tsc" */
+    std::string		to_string( clock_source s );
+
+    /** This namespace contains functions that read the issue timestamps.
+      */
+    namespace clock
+    {
+	/** The time of an issue, the monotonic time allows to measure exact intervals between issues
+	  * regardless of the adjustments of the system time.
+	  */
+	struct Timestamp
+	{
+	    std::chrono::system_clock::time_point	m_time;
+	    std::chrono::steady_clock::time_point	m_monotonic;
+	};
+
+	Timestamp now( ers::clock_source source );
+
+	/** Returns the clock source for the issues of the given severity. The clock sources are read from
+	  * the TDAQ_ERS_CLOCK environment variable, which contains either a single clock source for all
+	  * severities or comma separated list of SEVERITY=source pairs, e.g. "DEBUG=coarse,LOG=tsc".
+	  */
+	ers::clock_source source( ers::severity severity );
+
+	void source( ers::severity severity, ers::clock_source source );
+
+	/** Returns the description of the errors found in the TDAQ_ERS_CLOCK environment variable.
+	  */
+	const std::string & configuration_error();
+
+	/** Returns the description of the problems, which make ERS use another clock source than the one
+	  * selected by the TDAQ_ERS_CLOCK environment variable, e.g. missing support of the TSC clock.
+	  */
+	const std::string & configuration_warning();
+
+	/** Returns severity of the issues, which are created by this thread at the moment.
+	  * This severity selects the clock source for their timestamps.
+	  */
+	ers::severity current_severity();
+
+	/** This class tells which severity will be given to the issues, which are created by the current
+	  * thread in the scope of its instance. It is used by the ERS_DEBUG, ERS_LOG and ERS_INFO macros,
+	  * since issues get their severity only when they are reported.
+	  */
+	class Scope
+	{
+	  public:
+	    explicit Scope( ers::severity severity );
+
+	    ~Scope();
+
+	  private:
+	    Scope( const Scope & ) = delete;
+	    Scope & operator=( const Scope & ) = delete;
+
+	    ers::severity m_previous;
+	};
+    }
+}
+
+#endif
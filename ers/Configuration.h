@@ -17,6 +17,8 @@
 
 #include <iostream>
 
+#include <ers/Clock.h>
+
 namespace ers
 {   
     class Issue;
@@ -55,11 +57,24 @@ namespace ers
         
         void verbosity_level( int verbosity_level );	/**< \brief can be used to set the current verbosity level */
         
+        bool raw_stack() const			/**< \brief returns true if stack frames are printed as module relative records */
+        { return m_raw_stack; }
+        
+        void raw_stack( bool raw_stack )	/**< \brief can be used to switch between raw and symbolic stack frames */
+        { m_raw_stack = raw_stack; }
+        
+        clock_source clock( ers::severity severity ) const	/**< \brief returns clock source for the issues of the given severity */
+        { return ers::clock::source( severity ); }
+        
+        void clock( ers::severity severity, clock_source source )	/**< \brief can be used to change clock source for the given severity */
+        { ers::clock::source( severity, source ); }
+        
       private:	
 	Configuration( );
                 
         int m_debug_level;		/**< \brief current active level for the debug stream */	
     	int m_verbosity_level;		/**< \brief current verbosity level for all streams */
+    	bool m_raw_stack;		/**< \brief stack frames are not resolved to symbols */
     };
     
     std::ostream & operator<<( std::ostream &, const ers::Configuration & );
@@ -21,6 +21,8 @@
 
 namespace ers
 {   
+    struct Frame;
+
     /** This class provides an abstract interface to access the context of an issue.
       *
       * \author Serguei Kolos
@@ -34,8 +36,12 @@ namespace ers
         
 	std::string position( int verbosity = ers::Configuration::instance().verbosity_level() ) const;		/**< \return position in the code */
 	
+	void position( std::string & out, int verbosity ) const;	/**< \brief appends position in the code to the given string */
+	
         std::vector<std::string> stack( ) const;		/**< \return stack frames vector */
 	
+        virtual std::vector<Frame> frames( ) const;		/**< \return module relative stack frames */
+	
         virtual Context * clone() const = 0;			/**< \return copy of the current context */
         virtual const char * cwd() const = 0;			/**< \return current working directory of the process */
         virtual const char * file_name() const = 0;		/**< \return name of the file which created the issue */
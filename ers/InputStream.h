@@ -40,12 +40,19 @@ namespace ers {
         /**< \brief Will be called when a new issue is received */
         void receive(const Issue &issue);
 
+        /**< \brief Will be called once the receiver is attached, streams which produce issues
+         *   on their own should not start delivering them before this call */
+        virtual void start() {
+            ;
+        }
+
     private:
         InputStream(const InputStream &other) = delete;
         InputStream& operator=(const InputStream&) = delete;
 
         void set_receiver(IssueReceiver *receiver) {
             m_receiver = receiver;
+            start();
         }
 
         IssueReceiver *m_receiver;
@@ -15,8 +15,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <sstream>
 #include <memory>
@@ -25,6 +27,7 @@
 #include <ers/IssueFactory.h>
 #include <ers/LocalContext.h>
 #include <ers/Severity.h>
+#include <ers/internal/AttributeCache.h>
 
 /** \file Issue.h This file defines the ers::Issue class, 
   * which is the base class for any user defined issue.
@@ -53,6 +56,35 @@ namespace ers
         }
     };
     
+    /** This class holds a reference to a function object, which prints a message to a standard C++ output stream.
+      * It is used to postpone formatting of an issue message until it is requested by an output stream.
+      * The referenced function object must outlive any use of the renderer.
+      */
+    class MessageRenderer
+    {
+      public:
+        MessageRenderer()
+          : m_object( 0 ),
+            m_render( 0 )
+        { ; }
+
+        template <class F>
+        explicit MessageRenderer( const F & f )
+          : m_object( &f ),
+            m_render( []( const void * object, std::ostream & out ) { (*static_cast<const F *>( object ))( out ); } )
+        { ; }
+
+        explicit operator bool() const
+        { return m_render; }
+
+        void operator()( std::ostream & out ) const
+        { m_render( m_object, out ); }
+
+      private:
+        const void * m_object;
+        void (*m_render)( const void *, std::ostream & );
+    };
+
     /** This is a base class for any user define issue.
       *  The class stores all attributes declared in a user define descendant class in a hashmap
       *  as sting key/value pairs. The object defines a number of methods for providing access to this map.
@@ -77,32 +109,55 @@ namespace ers
 		const std::string & message,
                 const std::exception & cause ); 	
 	
+	Issue(	const Context & context,
+		Issue && cause );
+
+	Issue(	const Context & context,
+		const std::string & message,
+                Issue && cause ); 	
+	
 	Issue( const Issue & other );
 	      
+	Issue( Issue && other );
+	      
 	virtual ~Issue() noexcept;
 	
-	virtual Issue * clone() const = 0;
+	virtual Issue * clone() const = 0;			/**< \brief returns a copy of this issue preserving the real issue type*/
+	
+	virtual Issue * move_clone()				/**< \brief same as above but moves this issue into the new one */
+	{ return clone(); }
 	
         virtual const char * get_class_name() const = 0;	/**< \brief Get key for class (used for serialisation)*/
        	
-        virtual void raise() const = 0;                         /**< \brief throws a copy of this issue preserving the real issue type*/
+        virtual void raise() const = 0;				/**< \brief throws a copy of this issue preserving the real issue type*/
+       	
+        virtual void move_raise()				/**< \brief same as above but moves this issue into the thrown one */
+	{ raise(); }
 	
 	void add_qualifier( const std::string & qualif );	/**< \brief adds a qualifier to the issue */
+
+	template <typename T>
+	void add_parameter( const std::string & key, T value )	/**< \brief adds or replaces a parameter of the issue */
+	{ set_value( key, value ); }
 	
 	const Issue * cause() const				/**< \brief return the cause Issue of this Issue */
-	{ return m_cause.get(); }
+	{ return m_payload->m_cause.get(); }
         
 	const Context & context() const				/**< \brief Context of the issue. */
-        { return *(m_context.get()); }
+        { return *(m_payload->m_context.get()); }
         
-        const std::string & message() const			/**< \brief General cause of the issue. */
-	{ return m_message; }
+        /** Returns the explanation text of the issue. If the text is produced by a message renderer, it is done
+          * by the first call of this function. Concurrent calls from several threads are safe, all of them
+          * return only when the text has been rendered.
+          */
+        const std::string & message() const
+	{ if ( m_render_state.load( std::memory_order_acquire ) != Rendered ) render_message(); return m_payload->m_message; }
         
 	const std::vector<std::string> & qualifiers() const	/**< \brief return array of qualifiers */
-        { return m_qualifiers; }
+        { return m_payload->m_qualifiers; }
         
 	const string_map & parameters() const                   /**< \brief return array of parameters */
-        { return m_values; }
+        { return m_payload->m_values; }
         
         ers::Severity severity() const				/**< \brief severity of the issue */
 	{ return m_severity; }
@@ -123,10 +178,15 @@ namespace ers
 	std::time_t time_t() const;				/**< \brief seconds since 1 Jan 1970 */
         
 	const system_clock::time_point & ptime() const		/**< \brief original time point of the issue */
-	{ return m_time; }
+	{ return m_payload->m_time; }
+        
+	/**< \brief monotonic time point of the issue, which can be used to measure intervals between issues
+	  *   of the same process. It is not set for the issues received from other processes */
+	const std::chrono::steady_clock::time_point & mtime() const
+	{ return m_payload->m_monotonic; }
         
         const char * what() const noexcept			/**< \brief General cause of the issue. */
-	{ return m_message.c_str(); }
+	{ return message().c_str(); }
         
 	ers::Severity set_severity( ers::Severity severity ) const;
 
@@ -151,26 +211,49 @@ namespace ers
 	template <typename T>
 	void set_value( const std::string & key, T value );
 
-	void set_message( const std::string & message )
-	{ m_message = message; }
+	void set_message( std::string_view message )
+	{ mutable_payload().m_message.assign( message ); m_renderer = MessageRenderer(); m_render_state = Rendered; }
+        
+	/**< \brief Sets a function that will produce the message text when it is requested for the first time */
+	void set_message_renderer( const MessageRenderer & renderer )
+	{ mutable_payload(); m_renderer = renderer; m_render_state = Pending; }
         
-	void prepend_message( const std::string & message );
+	void prepend_message( std::string_view message );
         
       private:        
+        /** Holds the issue attributes, which are shared by all copies of an issue. The payload is never
+          * modified while it is shared, an issue makes its own copy of the payload before changing it.
+          */
+        struct Payload
+        {
+	    std::shared_ptr<const Issue>	m_cause;	/**< \brief Issue that caused the current issue */
+	    std::shared_ptr<const Context>	m_context;	/**< \brief Context of the current issue */
+	    std::string				m_message;	/**< \brief Issue's explanation text */
+	    std::vector<std::string>		m_qualifiers;	/**< \brief List of associated qualifiers */
+	    system_clock::time_point		m_time;		/**< \brief Time when issue was thrown */
+	    std::chrono::steady_clock::time_point m_monotonic;	/**< \brief Monotonic time when issue was thrown */
+	    string_map				m_values;	/**< \brief List of user defined attributes. */
+	    AttributeCache			m_cache;	/**< \brief Numeric values of the attributes */
+        };
+
         Issue & operator=( const Issue & other ) = delete;
+
+	enum RenderState { Rendered, Pending, Rendering };
+
+	Payload & mutable_payload();
+
+	void render_message() const;
 					  
-	std::unique_ptr<const Issue>	m_cause;		/**< \brief Issue that caused the current issue */
-	std::unique_ptr<Context>	m_context;		/**< \brief Context of the current issue */
-	std::string			m_message;		/**< \brief Issue's explanation text */
-	std::vector<std::string>	m_qualifiers;		/**< \brief List of associated qualifiers */
+	std::shared_ptr<Payload>	m_payload;		/**< \brief Attributes shared with the copies of this issue */
+	mutable MessageRenderer		m_renderer;		/**< \brief Produces the explanation text on demand */
+	mutable std::atomic<int>	m_render_state{ Rendered };	/**< \brief Guards the message renderer */
 	mutable Severity		m_severity;		/**< \brief Issue's severity */
-	system_clock::time_point	m_time;			/**< \brief Time when issue was thrown */
-	string_map			m_values;		/**< \brief List of user defined attributes. */	
     };
 
     std::ostream & operator<<( std::ostream &, const ers::Issue & );    
 } // ers
         
+#include <ers/internal/Format.h>
 #include <ers/internal/IssueDeclarationMacro.h>
 
 ERS_DECLARE_ISSUE(  ers,
@@ -182,11 +265,27 @@ template <typename T>
 void 
 ers::Issue::get_value( const std::string & key, T & value ) const
 {
-    string_map::const_iterator it = m_values.find(key);
-    if ( it == m_values.end() )
+    if constexpr ( AttributeCache::is_cacheable<T> )
+    {
+	if ( m_payload->m_cache.get( key, value ) )
+	{
+	    return;
+	}
+    }
+
+    string_map::const_iterator it = m_payload->m_values.find(key);
+    if ( it == m_payload->m_values.end() )
     {
 	throw ers::NoValue( ERS_HERE, key );
     }
+
+    if constexpr ( AttributeCache::is_cacheable<T> )
+    {
+	if ( m_payload->m_cache.parse( key, it->second, value ) )
+	{
+	    return;
+	}
+    }
     std::istringstream in( it->second );
     in >> value;
 }
@@ -195,9 +294,24 @@ template <typename T>
 void 
 ers::Issue::set_value( const std::string & key, T value )
 {
-    std::ostringstream out;
-    out << value;
-    m_values[key] = out.str();
+    Payload & payload = mutable_payload();
+    if constexpr ( AttributeCache::is_cacheable<T> && std::is_integral_v<T> )
+    {
+	// integers are printed exactly, so the value can be cached right away
+	char buf[32];
+	std::to_chars_result r = std::to_chars( buf, buf + sizeof( buf ), +value );
+	payload.m_values[key].assign( buf, r.ptr );
+	payload.m_cache.set( key, value );
+    }
+    else
+    {
+	// floating point values are cached when they are read, as the
+	// text representation might have a lower precision
+	std::ostringstream out;
+	out << value;
+	payload.m_values[key] = out.str();
+	payload.m_cache.erase( key );
+    }
 }
 
 template <class Precision>
@@ -213,7 +327,7 @@ ers::Issue::time(const std::string & format, bool isUTC) const
     std::strftime(buff, 128 - 16, format.c_str(), &tm);
 
     auto c = std::chrono::duration_cast<Precision>(
-			m_time.time_since_epoch()).count();
+			m_payload->m_time.time_since_epoch()).count();
     double frac = c - (double)t*Precision::period::den;
     sprintf(buff + strlen(buff), ",%0*.0f", width, frac);
 
@@ -11,8 +11,11 @@
 #ifndef ERS_ISSUE_FACTORY
 #define ERS_ISSUE_FACTORY
 
+#include <stdint.h>
+
 #include <chrono>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 
@@ -46,14 +49,32 @@ namespace ers
 	template <class > friend class SingletonCreator;
         
 	typedef Issue * (*IssueCreator)( const ers::Context & );
-	typedef std::map<std::string,IssueCreator> FunctionMap;
 
       public:
+	/** Numeric identifier of an issue type, which is the 64 bit FNV-1a hash of the issue class name.
+	  * It is the same for all processes and can be used instead of the class name for serialization.
+	  */
+	typedef uint64_t TypeId;
+
+	static constexpr TypeId type_id( std::string_view name )		/**< \brief returns type id for the given issue class name */
+	{
+	    TypeId hash = 0xcbf29ce484222325ULL;
+	    for ( char c : name )
+	    {
+		hash = ( hash ^ (unsigned char)c ) * 0x100000001b3ULL;
+	    }
+	    return hash;
+	}
+
 	static IssueFactory & instance();					/**< \brief method to access singleton */
 
 	Issue * create( const std::string & name,
         		const Context & context ) const ;			/**< \brief build an empty issue for a given name */
 	
+	Issue * create( TypeId id,
+			const std::string & name,
+        		const Context & context ) const ;			/**< \brief build an empty issue for a given type id */
+	
         Issue * create( const std::string & name,
         		const Context & context,
                         Severity severity,
@@ -63,13 +84,35 @@ namespace ers
                         const std::map<std::string, std::string> & parameters,
                         const Issue * cause = 0 ) const ;			/**< \brief build issue out of all the given parameters */
 	
+        Issue * create( TypeId id,
+			const std::string & name,
+        		const Context & context,
+                        Severity severity,
+                        const system_clock::time_point & time,
+                        std::string && message,
+                        std::vector<std::string> && qualifiers,
+                        std::map<std::string, std::string> && parameters,
+                        const Issue * cause = 0 ) const ;			/**< \brief build issue moving the given parameters into it */
+	
         void register_issue( const std::string & name, IssueCreator creator );	/**< \brief register an issue factory */
       
       private:
+	struct Entry
+	{
+	    std::string		m_name;
+	    TypeId		m_id;
+	    IssueCreator	m_creator;
+	};
+
 	IssueFactory()
         { ; }
         
-	FunctionMap m_creators;     
+	const Entry * find( TypeId id, std::string_view name ) const;
+
+	void rehash( size_t size );
+
+	std::vector<Entry>	m_entries;	/**< \brief registered issue types */
+	std::vector<uint32_t>	m_table;	/**< \brief open addressing hash table of entry indices + 1 */
     };
 
     std::ostream& operator<<(std::ostream&, const IssueFactory& factory);         /**< \brief streaming operator */
@@ -87,8 +87,7 @@ namespace ers
         const char * package_name() const		/**< \return CMT package name */
         { return m_package_name; }
         
-        pid_t process_id() const			/**< \return process id */
-        { return ::getpid(); }
+        pid_t process_id() const;			/**< \return process id */
         
         pid_t thread_id() const				/**< \return thread id */
         { return m_thread_id; }
@@ -107,6 +106,9 @@ namespace ers
 
         const char * application_name() const;		/**< \return application name */
 
+        /** Invalidates the cached process id, thread id and application name. This function is
+          * called automatically in the child process after fork.
+          */
         static void resetProcessContext();
 
       private:
@@ -15,10 +15,11 @@
   * \brief ers header and documentation file
   */
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <iostream>
-#include <queue>
 #include <mutex>
 #include <thread>
 
@@ -39,6 +40,12 @@ namespace ers
     class IssueCatcherHandler;
     
     /** The \c LocalStream class can be used for passing issues between threads of the same process.
+      * Issues, which are waiting for the issue catcher thread, are kept in separate queues for every severity.
+      * Fatal issues are always dispatched first. By default the other queues are served in the strict order
+      * of their severities, i.e. a warning is dispatched only if no errors are waiting. If the
+      * TDAQ_ERS_CATCHER_WEIGHT environment variable is set to a positive number N the queues are served by
+      * weighted priority: after N issues of a higher severity one issue of the next lower severity is dispatched,
+      * so a flood of errors can not delay warnings indefinitely.
       *
       * \author Serguei Kolos
       * \version 1.2
@@ -64,6 +71,23 @@ namespace ers
 	
         void warning( const ers::Issue & issue );
 
+	void report_batch( ers::severity type, const ers::Issue * const * issues, size_t count );
+
+	/** Statistics of the issues passed to the issue catcher with a certain severity */
+	struct Statistics
+	{
+	    uint64_t				m_dispatched;	/**< \brief number of issues passed to the catcher */
+	    size_t				m_pending;	/**< \brief number of issues waiting in the queue */
+	    std::chrono::steady_clock::duration	m_total_latency;/**< \brief sum of the waiting times */
+	    std::chrono::steady_clock::duration	m_max_latency;	/**< \brief longest waiting time */
+	};
+
+	//! returns statistics of the queue for the given severity
+	Statistics statistics( ers::severity type ) const;
+
+	//! sets the weight used for dispatching issues of different severities, 0 means strict priority
+	void dispatch_weight( unsigned int weight );
+
       private:
 	LocalStream( );
 	~LocalStream( );
@@ -72,15 +96,27 @@ namespace ers
 
 	void report_issue( ers::severity type, const ers::Issue & issue );
         
+	void enqueue( ers::Issue * issue, std::chrono::steady_clock::time_point time );
+
+	int select_queue( size_t & count );
+
 	void thread_wrapper();
 
+	struct Queue
+	{
+	    std::deque<std::pair<ers::Issue *, std::chrono::steady_clock::time_point> >	m_issues;
+	    Statistics									m_statistics;
+	};
+
       private:
 	std::function<void ( const ers::Issue & )>	m_issue_catcher;
 	std::unique_ptr<std::thread>			m_issue_catcher_thread;
-	std::mutex					m_mutex;
+	mutable std::mutex				m_mutex;
 	std::condition_variable			        m_condition;
 	bool						m_terminated;
-	std::queue<ers::Issue *>			m_issues;
+	Queue						m_queues[ers::Fatal + 1];
+	unsigned int					m_weight;
+	unsigned int					m_credit;	/**< \brief issues of higher severities left before a lower one is served */
 	std::thread::id					m_catcher_thread_id;
     };
 }
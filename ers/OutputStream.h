@@ -38,6 +38,7 @@ namespace ers
     class OutputStream
     {
       friend class StreamManager;
+      friend class StreamFactory;
       
       public:
 	virtual ~OutputStream()
@@ -45,6 +46,10 @@ namespace ers
         
 	/**< \brief Sends the issue into this stream */
 	virtual void write( const Issue & issue ) = 0;
+
+	/**< \brief Sends several issues of the same severity into this stream. The default implementation
+	  *   calls \c write for each of them, streams may override it to amortize their locks and system calls */
+	virtual void write_batch( const Issue * const * issues, size_t count );
 	
       protected:
         OutputStream( );
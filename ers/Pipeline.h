@@ -0,0 +1,314 @@
+/*
+ *  Pipeline.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file Pipeline.h This file defines the Pipeline class, which composes ERS streams at compile time.
+  * \brief ers header and documentation file
+  */
+
+#ifndef ERS_PIPELINE_H
+#define ERS_PIPELINE_H
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <ers/Configuration.h>
+#include <ers/Issue.h>
+#include <ers/OutputStream.h>
+#include <ers/StandardStreamOutput.h>
+#include <ers/internal/Format.h>
+
+namespace ers
+{
+    /** This namespace contains the stages which can be used with the ers::Pipeline class.
+      * A stage is a class with the following method, which has to call \c next for every issue
+      * which shall be passed to the following stage:
+      *
+      *	    template <class Next> void write( const ers::Issue & issue, Next && next );
+      */
+    namespace pipeline
+    {
+	/** The same as the "throttle(Initial,Period)" stream. Unlike the runtime stream this stage
+	  * does not format the time of every issue, it is done only for the suppression notices.
+	  */
+	template <int Initial = 30, int Period = 30>
+	class Throttle
+	{
+	    struct Record
+	    {
+		std::time_t	m_last_occurance = 0;
+		std::time_t	m_last_report = 0;
+		system_clock::time_point m_last_occurance_time;	/**< \brief formatted only for the suppression notice */
+		int		m_initial_counter = 0;
+		int		m_threshold = 10;
+		int		m_suppressed_counter = 0;
+	    };
+
+	    /** Issues are throttled per source position, the file name is compared by value since
+	      * the contexts of issues received from other processes own their copies of it.
+	      */
+	    struct Position
+	    {
+		std::string	m_file;
+		int		m_line;
+	    };
+
+	    struct PositionView
+	    {
+		std::string_view	m_file;
+		int			m_line;
+	    };
+
+	    struct Less
+	    {
+		using is_transparent = void;
+
+		template <class A, class B>
+		bool operator()( const A & a, const B & b ) const
+		{
+		    return a.m_line < b.m_line
+			|| ( a.m_line == b.m_line && std::string_view( a.m_file ) < std::string_view( b.m_file ) );
+		}
+	    };
+
+	  public:
+	    template <class Next>
+	    void write( const Issue & issue, Next && next )
+	    {
+		const Context & context = issue.context();
+		PositionView position{ context.file_name(), context.line_number() };
+
+		std::scoped_lock lock( m_mutex );
+		auto it = m_records.find( position );
+		if ( it == m_records.end() )
+		{
+		    it = m_records.emplace( Position{ std::string( position.m_file ), position.m_line }, Record() ).first;
+		}
+		Record & record = it->second;
+		std::time_t time = issue.time_t();
+		bool reported = false;
+		if ( time - record.m_last_occurance > Period )
+		{
+		    if ( record.m_suppressed_counter > 0 )
+		    {
+			report_suppression( record, issue, next );
+			reported = true;
+		    }
+		    record = Record();
+		}
+
+		if ( record.m_initial_counter < Initial )
+		{
+		    record.m_initial_counter++;
+		    record.m_last_report = time;
+		    if ( !reported )
+		    {
+			next( issue );
+		    }
+		}
+		else if ( record.m_suppressed_counter >= record.m_threshold )
+		{
+		    record.m_threshold *= 10;
+		    report_suppression( record, issue, next );
+		}
+		else if ( time - record.m_last_report > Period )
+		{
+		    report_suppression( record, issue, next );
+		}
+		else
+		{
+		    record.m_suppressed_counter++;
+		}
+
+		record.m_last_occurance = time;
+		record.m_last_occurance_time = issue.ptime();
+	    }
+
+	  private:
+	    template <class Next>
+	    void report_suppression( Record & record, const Issue & issue, Next && next )
+	    {
+		std::ostringstream out;
+		out << " -- " << record.m_suppressed_counter << " similar messages suppressed, last occurrence was at "
+		    << format( record.m_last_occurance_time );
+
+		std::unique_ptr<Issue> notice( issue.clone() );
+		notice->wrap_message( "", out.str() );
+		notice->set_severity( issue.severity() );
+		next( *notice );
+
+		record.m_last_report = issue.time_t();
+		record.m_suppressed_counter = 0;
+	    }
+
+	    static std::string format( const system_clock::time_point & time )
+	    {
+		std::time_t t = system_clock::to_time_t( time );
+		std::tm tm;
+		localtime_r( &t, &tm );
+
+		char buff[128];
+		size_t size = std::strftime( buff, sizeof( buff ), "%Y-%b-%d %H:%M:%S", &tm );
+		long us = std::chrono::duration_cast<std::chrono::microseconds>( time.time_since_epoch() ).count() % 1000000;
+		snprintf( buff + size, sizeof( buff ) - size, ",%06ld", us );
+		return buff;
+	    }
+
+	    std::mutex					m_mutex;
+	    std::map<Position, Record, Less>		m_records;
+	};
+
+	/** The same as the "filter(Qualifiers)" stream. The template parameter must point to a string
+	  * with static storage duration, e.g.
+	  *
+	  *	static constexpr char qualifiers[] = "internal,!test";
+	  *	typedef ers::pipeline::Filter<qualifiers> MyFilter;
+	  */
+	template <const char * Qualifiers>
+	class Filter
+	{
+	  public:
+	    Filter()
+	    {
+		std::string_view format( Qualifiers );
+		while ( !format.empty() )
+		{
+		    std::string_view token = format.substr( 0, format.find( ',' ) );
+		    format.remove_prefix( std::min( format.size(), token.size() + 1 ) );
+		    if ( token.empty() )
+			continue;
+		    if ( token[0] == '!' )
+			m_exclude.emplace_back( token.substr( 1 ) );
+		    else
+			m_include.emplace_back( token );
+		}
+	    }
+
+	    template <class Next>
+	    void write( const Issue & issue, Next && next )
+	    {
+		const std::vector<std::string> & qualifiers = issue.qualifiers();
+		for ( const std::string & q : qualifiers )
+		{
+		    for ( const std::string & e : m_exclude )
+			if ( q == e )
+			    return;
+		}
+
+		bool accepted = m_include.empty();
+		for ( size_t i = 0; !accepted && i < qualifiers.size(); ++i )
+		{
+		    for ( const std::string & a : m_include )
+		    {
+			if ( qualifiers[i] == a )
+			{
+			    accepted = true;
+			    break;
+			}
+		    }
+		}
+
+		if ( accepted )
+		    next( issue );
+	    }
+
+	  private:
+	    std::vector<std::string> m_include;
+	    std::vector<std::string> m_exclude;
+	};
+
+	/** Prints issues to a standard C++ stream holding a lock, which is shared by all the
+	  * stages with the same Discriminator. This stage passes all issues to the next one.
+	  */
+	template <std::ostream & (*Stream)(), int Discriminator>
+	class Print
+	{
+	  public:
+	    template <class Next>
+	    void write( const Issue & issue, Next && next )
+	    {
+		{
+		    ers::fmt::Buffer buffer;
+		    StandardStreamOutput::print( buffer.str(), issue, Configuration::instance().verbosity_level() );
+		    buffer.str().push_back( '\n' );
+		    std::scoped_lock lock( mutex() );
+		    Stream().write( buffer.str().data(), buffer.str().size() ).flush();
+		}
+		next( issue );
+	    }
+
+	  private:
+	    static std::mutex & mutex()
+	    {
+		static std::mutex * m = new std::mutex;
+		return *m;
+	    }
+	};
+
+	inline std::ostream & cout()
+	{ return std::cout; }
+
+	inline std::ostream & cerr()
+	{ return std::cerr; }
+
+	typedef Print<cout, 1> StdOut;	/**< \brief the same as the "lstdout" stream */
+	typedef Print<cerr, 2> StdErr;	/**< \brief the same as the "lstderr" stream */
+    }
+
+    /** This class implements an output stream, which passes issues through the given stages
+      * that are composed at compile time. For example:
+      *
+      *	    static constexpr char qualifiers[] = "!test";
+      *	    typedef ers::Pipeline<ers::pipeline::Throttle<30,30>,
+      *				  ers::pipeline::Filter<qualifiers>,
+      *				  ers::pipeline::StdErr> MyStream;
+      *
+      * behaves as the "throttle(30,30),filter(!test),lstderr" configuration, but all the stages are
+      * called without virtual calls and can be inlined by the compiler. The issues, which pass all the
+      * stages, are sent to the chained stream. A pipeline can be registered as any other output stream:
+      *
+      *	    ERS_REGISTER_OUTPUT_STREAM( MyStream, "mystream", ERS_EMPTY )
+      *
+      * \brief Compile time composition of ERS streams.
+      */
+    template <class ... Stages>
+    class Pipeline : public OutputStream
+    {
+      public:
+	Pipeline()
+	{ ; }
+
+	void write( const Issue & issue ) override
+	{ process<0>( issue ); }
+
+      private:
+	template <size_t I>
+	void process( const Issue & issue )
+	{
+	    if constexpr ( I == sizeof...( Stages ) )
+		chained().write( issue );
+	    else
+		std::get<I>( m_stages ).write( issue, [this]( const Issue & i ) { process<I + 1>( i ); } );
+	}
+
+	std::tuple<Stages ...>	m_stages;
+    };
+}
+
+#endif
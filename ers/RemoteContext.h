@@ -15,7 +15,10 @@
   * which implements the ers::Context interface.
   */ 
 
+#include <vector>
+
 #include <ers/Context.h>
+#include <ers/internal/Symbolizer.h>
 
 namespace ers
 {   
@@ -55,17 +58,20 @@ namespace ers
           * \param filename name of the source code file
 	  * \param line_number line_number in the source code
 	  * \param function_name name of the function
+	  * \param frames module relative stack frames recorded by the original process
 	  */
 	RemoteContext(	const std::string & package,
         		const std::string & filename,
         		int line_number,
                         const std::string & function_name,
-                        const RemoteProcessContext & pc )
+                        const RemoteProcessContext & pc,
+                        std::vector<Frame> frames = std::vector<Frame>() )
 	  : m_process( pc ),
 	    m_package_name( package ),
             m_file_name( filename ),
 	    m_function_name( function_name ),
-	    m_line_number( line_number )
+	    m_line_number( line_number ),
+	    m_frames( std::move( frames ) )
 	{ ; }
 
         virtual ~RemoteContext()
@@ -104,6 +110,9 @@ namespace ers
         int stack_size() const				/**< \return number of frames in stack */
         { return 0; }
         
+        std::vector<Frame> frames() const		/**< \return stack frames recorded by the original process */
+        { return m_frames; }
+        
         int user_id() const				/**< \return user id */
         { return m_process.m_uid; }
         
@@ -119,6 +128,7 @@ namespace ers
         const std::string		m_file_name;		/**< source file name */
 	const std::string		m_function_name;	/**< source function name */
 	const int			m_line_number;		/**< source line number */	
+	const std::vector<Frame>	m_frames;		/**< module relative stack frames */
     };
 }
 
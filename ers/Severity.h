@@ -16,6 +16,7 @@
 #define ERS_SEVERITY_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 
@@ -43,6 +44,7 @@ namespace ers
     Severity 	parse( const std::string & s, Severity & );
     std::string	to_string( severity s );
     std::string	to_string( Severity s );
+    std::string_view severity_name( severity s );	/**< \brief same as to_string but does not allocate memory */
 
     inline std::ostream & operator<<( std::ostream & out, ers::severity severity )
     {
@@ -16,6 +16,7 @@
 #define ERS_STANDARD_STREAM_OUTPUT_H
 
 #include <iostream>
+#include <string>
 
 namespace ers
 {
@@ -30,6 +31,11 @@ namespace ers
     {
         static std::ostream & print( std::ostream & out, const Issue & issue, int verbosity );
         static std::ostream & println( std::ostream & out, const Issue & issue, int verbosity );
+        
+        /** Appends the text representation of the issue to the given string. This function does not allocate
+          * memory if the string has enough capacity, unless the stack trace is printed for verbosity above 3.
+          */
+        static void print( std::string & out, const Issue & issue, int verbosity );
     };
 }
     
@@ -14,8 +14,10 @@
 #include <ers/Severity.h>
 #include <ers/Context.h>
 #include <ers/Issue.h>
+#include <ers/internal/PluginManager.h>
 
 #include <map>
+#include <mutex>
 
 /** \file StreamFactory.h This file defines the StreamFactory class, 
   * which is responsible for registration and creation of ERS streams.
@@ -69,15 +71,22 @@ namespace ers
 	
         OutputStream * create_out_stream( const std::string & format ) const;	/**< \brief create new stream */
 	
+        OutputStream * create_out_chain( const std::vector<std::string> & streams ) const; /**< \brief create chain of streams */
+	
       private:	
 	StreamFactory( )
         { ; }
 
+	template <class Map>
+	typename Map::mapped_type find( const Map & factories, const std::string & name ) const;
+
 	typedef std::map<std::string, InputStreamCreator>	InFunctionMap;
 	typedef std::map<std::string, OutputStreamCreator>	OutFunctionMap;
         
 	InFunctionMap	m_in_factories;		/**< \brief collection of factories to build input streams */	
 	OutFunctionMap	m_out_factories;	/**< \brief collection of factories to build output streams */	
+	mutable std::recursive_mutex	m_mutex;
+	mutable PluginManager		m_plugin_manager;	/**< \brief loads the stream libraries on demand */
     };
     
     std::ostream & operator<<( std::ostream &, const ers::StreamFactory & );
@@ -19,7 +19,6 @@
 #include <ers/Context.h>
 #include <ers/IssueReceiver.h>
 #include <ers/StreamFactory.h>
-#include <ers/internal/PluginManager.h>
 
 #include <list>
 
@@ -94,13 +93,14 @@ namespace ers
       
 	void report_issue( ers::severity type, const Issue & issue );
 
+	void report_batch( ers::severity type, const Issue * const * issues, size_t count, int level = 0 );
+
       private:	
 	StreamManager( );
 
 	OutputStream * setup_stream( ers::severity severity );	
 	OutputStream * setup_stream( const std::vector<std::string> & streams );
         
-	PluginManager					m_plugin_manager;
 	std::mutex					m_mutex;
 	std::list<std::shared_ptr<InputStream> >	m_in_streams;
 	std::shared_ptr<OutputStream>			m_init_streams[ers::Fatal + 1];	/**< \brief array of pointers to streams per severity */
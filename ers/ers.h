@@ -21,6 +21,7 @@
 #include <functional>
 #include <sstream>
 #include <ers/StreamManager.h>
+#include <ers/Clock.h>
 #include <ers/Configuration.h>
 #include <ers/Issue.h>
 #include <ers/Assertion.h>
@@ -115,6 +116,24 @@ namespace ers
     inline void warning( const Issue & issue )
     { LocalStream::instance().warning( issue ); }
 
+    /*! 
+     *  This function sends several issues to the ERS stream of the given severity with a single call, which
+     *  allows the streams to process them together. Error, warning and fatal issues are passed to the local
+     *  issue catcher if it has been set.
+     *  \param type severity of the stream
+     *  \param issues array of pointers to the issues to be reported
+     *  \param count number of issues
+     *  \param level debug level of the issues, which are reported only if it does not exceed the current
+     *	debug level. It is ignored for the other severities.
+     */
+    inline void report_batch( ers::severity type, const Issue * const * issues, size_t count, int level = 0 )
+    {
+	if ( type >= ers::Warning )
+	    LocalStream::instance().report_batch( type, issues, count );
+	else
+	    StreamManager::instance().report_batch( type, issues, count, level );
+    }
+
     inline int enable_core_dump() {
         rlimit core_limit = { RLIM_INFINITY, RLIM_INFINITY };
         return setrlimit( RLIMIT_CORE, &core_limit );
@@ -123,6 +142,42 @@ namespace ers
 
 ERS_DECLARE_ISSUE( ers, Message, ERS_EMPTY, ERS_EMPTY )
 
+namespace ers
+{
+    /** This class is a variant of ers::Message, which formats its text only when the text is
+      * requested by one of the output streams. Issues, which are dropped by filtering or throttling
+      * streams, therefore do not spend any time on formatting. The message renderer must stay valid
+      * while the issue is being reported, any copy of this issue gets already formatted text.
+      * This class is used by the ERS_DEBUG, ERS_LOG and ERS_INFO macro.
+      */
+    class DeferredMessage : public Message
+    {
+      public:
+	DeferredMessage( const Context & context, const MessageRenderer & renderer )
+	  : Message( context )
+	{ set_message_renderer( renderer ); }
+    };
+
+    /** This class is a variant of ers::Message, which copies its text directly to the issue payload.
+      * This class is used by the ERS_DEBUGF, ERS_LOGF and ERS_INFOF macro together with a thread
+      * local buffer, so the formatted text is copied only once.
+      */
+    class FormattedMessage : public Message
+    {
+      public:
+	FormattedMessage( const Context & context, std::string_view message )
+	  : Message( context )
+	{ set_message( message ); }
+    };
+}
+
+#define ERS_REPORT_FORMATTED_IMPL( stream, level, ... ) \
+{ \
+    ers::fmt::Buffer ers_report_impl_buffer; \
+    stream( ers::FormattedMessage( ERS_HERE, ERS_FORMAT_VIEW( ers_report_impl_buffer.str(), __VA_ARGS__ ) ) \
+	    BOOST_PP_COMMA_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY level ) ) ) level ); \
+}
+
 #define ERS_REPORT_IMPL( stream, issue, message, level ) \
 { \
     std::ostringstream ers_report_impl_out_buffer; \
@@ -131,6 +186,14 @@ ERS_DECLARE_ISSUE( ers, Message, ERS_EMPTY, ERS_EMPTY )
 	    BOOST_PP_COMMA_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY level ) ) ) level ); \
 }
 
+#define ERS_REPORT_DEFERRED_IMPL( stream, message, level ) \
+{ \
+    auto ers_report_impl_renderer = [&]( std::ostream & ers_report_impl_out ) \
+    { ers_report_impl_out << message; }; \
+    stream( ers::DeferredMessage( ERS_HERE, ers::MessageRenderer( ers_report_impl_renderer ) ) \
+	    BOOST_PP_COMMA_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY level ) ) ) level ); \
+}
+
 #ifndef ERS_NO_DEBUG
 /** \def ERS_DEBUG( level, message) This macro sends the message to the ers::debug stream
  * if level is less or equal to the TDAQ_ERS_DEBUG_LEVEL, which is equal to 0 by default.
@@ -139,7 +202,8 @@ ERS_DECLARE_ISSUE( ers, Message, ERS_EMPTY, ERS_EMPTY )
 #define ERS_DEBUG( level, message ) do { \
 if ( ers::debug_level() >= level ) \
 { \
-    ERS_REPORT_IMPL( ers::debug, ers::Message, message, level ); \
+    ers::clock::Scope ers_clock_scope( ers::Debug ); \
+    ERS_REPORT_DEFERRED_IMPL( ers::debug, message, level ); \
 } } while(0)
 #else
 #define ERS_DEBUG( level, message ) do { } while(0)
@@ -149,15 +213,50 @@ if ( ers::debug_level() >= level ) \
  */
 #define ERS_INFO( message ) do { \
 { \
-    ERS_REPORT_IMPL( ers::info, ers::Message, message, ERS_EMPTY ); \
+    ers::clock::Scope ers_clock_scope( ers::Information ); \
+    ERS_REPORT_DEFERRED_IMPL( ers::info, message, ERS_EMPTY ); \
 } } while(0)
 
 /** \def ERS_LOG( message ) This macro sends the message to the ers::log stream.
  */
 #define ERS_LOG( message ) do { \
 { \
-    ERS_REPORT_IMPL( ers::log, ers::Message, message, ERS_EMPTY ); \
+    ers::clock::Scope ers_clock_scope( ers::Log ); \
+    ERS_REPORT_DEFERRED_IMPL( ers::log, message, ERS_EMPTY ); \
 } } while(0)
 
+#ifndef ERS_NO_DEBUG
+/** \def ERS_DEBUGF( level, format, ... ) This macro sends the message produced from the format string
+ * and the given arguments to the ers::debug stream if level is less or equal to the TDAQ_ERS_DEBUG_LEVEL.
+ * The format string must be a literal, which is checked at compile time. See ers/internal/Format.h
+ * for the syntax of the format string.
+ * \note This macro is defined to empty statement if the \c ERS_NO_DEBUG macro is defined
+ */
+#define ERS_DEBUGF( level, ... ) do { \
+if ( ers::debug_level() >= level ) \
+{ \
+    ers::clock::Scope ers_clock_scope( ers::Debug ); \
+    ERS_REPORT_FORMATTED_IMPL( ers::debug, level, __VA_ARGS__ ); \
+} } while(0)
+#else
+#define ERS_DEBUGF( level, ... ) do { } while(0)
+#endif
+
+/** \def ERS_INFOF( format, ... ) This macro sends the message produced from the format string
+ * and the given arguments to the ers::info stream.
+ */
+#define ERS_INFOF( ... ) do { \
+    ers::clock::Scope ers_clock_scope( ers::Information ); \
+    ERS_REPORT_FORMATTED_IMPL( ers::info, ERS_EMPTY, __VA_ARGS__ ); \
+} while(0)
+
+/** \def ERS_LOGF( format, ... ) This macro sends the message produced from the format string
+ * and the given arguments to the ers::log stream.
+ */
+#define ERS_LOGF( ... ) do { \
+    ers::clock::Scope ers_clock_scope( ers::Log ); \
+    ERS_REPORT_FORMATTED_IMPL( ers::log, ERS_EMPTY, __VA_ARGS__ ); \
+} while(0)
+
 #endif // ERS_ERS_H
 
@@ -0,0 +1,185 @@
+/*
+ *  AttributeCache.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file AttributeCache.h This file defines the ers::AttributeCache class, which keeps
+  * the values of the numeric issue attributes in their binary form.
+  * \brief ers header file
+  */
+
+#ifndef ERS_ATTRIBUTE_CACHE_H
+#define ERS_ATTRIBUTE_CACHE_H
+
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace ers
+{
+    /** Issue attributes are stored as strings. This class remembers the numeric values of these attributes,
+      * so they don't have to be parsed again each time they are read. The values are either put into the
+      * cache when the attribute is set or when it is parsed for the first time.
+      * The values are kept in a list, which is only extended by the readers, so it can be searched and
+      * extended by several threads without locking. Issues have only a few attributes, so a linear search
+      * is faster than any lookup table. The list is modified in other ways only by the set and erase
+      * functions, which are used by the issue owning the cache exclusively.
+      * \brief Cache of the numeric issue attributes.
+      */
+    class AttributeCache
+    {
+	typedef std::variant<long long, unsigned long long, double> Value;
+
+	template <class T>
+	using Storage = std::conditional_t<std::is_floating_point_v<T>, double,
+				std::conditional_t<std::is_signed_v<T>, long long, unsigned long long> >;
+
+	struct Entry
+	{
+	    std::string	m_key;
+	    Value	m_value;
+	    Entry *	m_next;
+	};
+
+      public:
+	/** Only these types can be cached. Character types are excluded as they are not stored as numbers.
+	  */
+	template <class T>
+	static constexpr bool is_cacheable = std::is_arithmetic_v<T>
+		&& !std::is_same_v<T, char> && !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char>
+		&& !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+	AttributeCache()
+	  : m_head( 0 )
+	{ ; }
+
+	AttributeCache( const AttributeCache & other )
+	  : m_head( 0 )
+	{
+	    Entry * head = 0;
+	    Entry ** tail = &head;
+	    for ( const Entry * e = other.m_head.load( std::memory_order_acquire ); e; e = e->m_next )
+	    {
+		*tail = new Entry{ e->m_key, e->m_value, 0 };
+		tail = &(*tail)->m_next;
+	    }
+	    m_head.store( head, std::memory_order_release );
+	}
+
+	~AttributeCache()
+	{
+	    clear( m_head.load( std::memory_order_relaxed ) );
+	}
+
+	AttributeCache & operator=( const AttributeCache & ) = delete;
+
+	/** Reads the cached value of the given attribute.
+	  * \return false if the attribute is not in the cache or its value does not fit into T
+	  */
+	template <class T>
+	bool get( const std::string & key, T & value ) const
+	{
+	    const Entry * e = find<Storage<T> >( key );
+	    return e && convert( std::get<Storage<T> >( e->m_value ), value );
+	}
+
+	/** Parses the given text and puts the result into the cache.
+	  * \return false if the text does not contain a valid number, which fits into T. In this case the caller
+	  * has to use the standard input operator, which sets the value as required by the C++ standard.
+	  */
+	template <class T>
+	bool parse( const std::string & key, const std::string & text, T & value ) const
+	{
+	    Storage<T> result;
+	    const char * end = text.data() + text.size();
+	    std::from_chars_result r = std::from_chars( text.data(), end, result );
+	    if ( r.ec != std::errc() || r.ptr != end || !convert( result, value ) )
+		return false;
+
+	    Entry * e = new Entry{ key, result, m_head.load( std::memory_order_relaxed ) };
+	    while ( !m_head.compare_exchange_weak( e->m_next, e, std::memory_order_release, std::memory_order_relaxed ) )
+		;
+	    return true;
+	}
+
+	template <class T>
+	void set( const std::string & key, T value )
+	{
+	    erase( key );
+	    Entry * e = new Entry{ key, static_cast<Storage<T> >( value ), m_head.load( std::memory_order_relaxed ) };
+	    m_head.store( e, std::memory_order_release );
+	}
+
+	void erase( const std::string & key )
+	{
+	    Entry * head = m_head.load( std::memory_order_relaxed );
+	    Entry ** link = &head;
+	    while ( Entry * e = *link )
+	    {
+		if ( e->m_key == key )
+		{
+		    *link = e->m_next;
+		    delete e;
+		}
+		else
+		{
+		    link = &e->m_next;
+		}
+	    }
+	    m_head.store( head, std::memory_order_release );
+	}
+
+      private:
+	/** Looks for the value of the given attribute, which is stored as type S. A value can be cached
+	  * with different types if it is read as different types.
+	  */
+	template <class S>
+	const Entry * find( const std::string & key ) const
+	{
+	    for ( const Entry * e = m_head.load( std::memory_order_acquire ); e; e = e->m_next )
+		if ( std::holds_alternative<S>( e->m_value ) && e->m_key == key )
+		    return e;
+	    return 0;
+	}
+
+	/** Checks that the value fits into the target type, as the standard input operator does.
+	  */
+	template <class S, class T>
+	static bool convert( S source, T & value )
+	{
+	    if constexpr ( std::is_floating_point_v<T> )
+	    {
+		if ( source == source && std::abs( source ) != std::numeric_limits<S>::infinity()
+		  && std::abs( source ) > std::numeric_limits<T>::max() )
+		    return false;
+	    }
+	    else if ( source < std::numeric_limits<T>::lowest() || source > std::numeric_limits<T>::max() )
+	    {
+		return false;
+	    }
+	    value = static_cast<T>( source );
+	    return true;
+	}
+
+	static void clear( Entry * e )
+	{
+	    while ( e )
+	    {
+		Entry * next = e->m_next;
+		delete e;
+		e = next;
+	    }
+	}
+
+	mutable std::atomic<Entry *>	m_head;
+    };
+}
+
+#endif
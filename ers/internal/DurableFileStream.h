@@ -0,0 +1,78 @@
+/*
+ *  DurableFileStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file DurableFileStream.h This file defines DurableFileStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_DURABLE_FILE_STREAM_H
+#define ERS_DURABLE_FILE_STREAM_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class implements a thread-safe file stream, which can guarantee that an issue has reached
+      * the disk before the \c write function returns. In order to employ this implementation in a stream
+      * configuration the name to be used is "dfile". E.g. the following configuration makes sure that
+      * a fatal issue is stored to the "fatal.log" file before the application is aborted:
+      *
+      *         export TDAQ_ERS_FATAL="dfile(fatal.log),abort"
+      *
+      * This stream has two configuration parameters:
+      *   - name of the file, which is opened in append mode
+      *   - the lowest severity of issues which have to be synchronized to disk before \c write returns
+      *         (default is ERROR). Issues with lower severities are written in the same way but the
+      *         calling thread does not wait for them to be committed.
+      *
+      * Issues reported by concurrent threads are committed in groups: the first thread that finds the
+      * file idle writes all the pending records with a single \c writev call, which is followed by at most
+      * one \c fdatasync if any of these records requires it. The other threads either return immediately
+      * or wait until their records are committed by this thread.
+      *
+      * \brief Group commit file stream.
+      */
+
+    class DurableFileStream : public OutputStream
+    {
+      public:
+	explicit DurableFileStream( const std::string & format );
+
+        ~DurableFileStream();
+
+        void write( const Issue & issue ) override;
+
+      private:
+	struct Record
+        {
+            std::string	m_data;
+            bool	m_sync;
+        };
+
+	void commit( std::unique_lock<std::mutex> & lock );
+
+      private:
+	int			m_fd;
+	ers::severity		m_sync_severity;
+
+	std::mutex		m_mutex;
+	std::condition_variable	m_condition;
+	std::vector<Record>	m_pending;	/**< \brief records waiting for the next commit */
+	bool			m_committing;	/**< \brief a thread is writing a batch to the file */
+	uint64_t		m_enqueued;	/**< \brief sequence number of the last enqueued record */
+	uint64_t		m_committed;	/**< \brief sequence number of the last committed record */
+    };
+}
+
+#endif
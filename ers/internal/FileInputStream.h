@@ -0,0 +1,77 @@
+/*
+ *  FileInputStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file FileInputStream.h This file defines FileInputStream ERS input stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_FILE_INPUT_STREAM_H
+#define ERS_FILE_INPUT_STREAM_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ers/InputStream.h>
+
+namespace ers
+{
+
+    /** This class replays issues, which have been recorded by either the "bfile" or the "jfile" stream.
+      * The file format is detected automatically. In order to employ this implementation the name to be
+      * used is "file", e.g.
+      *
+      *         ers::StreamManager::instance().add_receiver( "file", { "errors.bin", "10" }, &receiver );
+      *
+      * This stream has two parameters:
+      *   - name of the file
+      *   - replay speed (default is 0). The value of 0 delivers the issues as fast as possible, the value
+      *         of 1 reproduces the original time intervals between them and any other value N makes
+      *         the replay N times faster than the original.
+      *
+      * The file is mapped into memory and decoded by several threads in parallel. The decoded issues are
+      * sorted by their time and delivered to the receiver by a dedicated thread, which is started when the
+      * receiver is attached to the stream. Malformed records, including a truncated binary frame at the end
+      * of the file, are skipped and reported.
+      *
+      * \brief Replays recorded issues.
+      */
+
+    class FileInputStream : public InputStream
+    {
+      public:
+	explicit FileInputStream( const std::initializer_list<std::string> & params );
+
+        ~FileInputStream();
+
+      protected:
+	void start() override;
+
+      private:
+	typedef std::vector<std::unique_ptr<Issue> > Issues;
+
+	void run();
+
+	Issues decode() const;
+
+      private:
+	const char *		m_data;
+	size_t			m_size;
+	bool			m_binary;
+	double			m_speed;
+
+	std::mutex		m_mutex;
+	std::condition_variable	m_condition;
+	bool			m_terminated;
+	std::thread		m_thread;
+    };
+}
+
+#endif
@@ -41,6 +41,8 @@ namespace ers
 	explicit FilterStream( const std::string & format );
 	
         void write( const Issue & issue ) override;
+
+        void write_batch( const Issue * const * issues, size_t count ) override;
         
       private:	
         bool is_accepted( const ers::Issue & issue );
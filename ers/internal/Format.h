@@ -0,0 +1,212 @@
+/*
+ *  Format.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file Format.h This file defines functions for formatting ERS messages with format strings.
+  * \brief ers header file
+  */
+
+#ifndef ERS_FORMAT_H
+#define ERS_FORMAT_H
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/preprocessor/variadic/elem.hpp>
+
+namespace ers
+{
+    /** This namespace contains the implementation of format strings, which can be used for ERS messages as an
+      * alternative to the standard C++ output operators. A format string contains either "{}" placeholders,
+      * which are replaced by the arguments in the given order, or "{N}" placeholders which refer to the argument
+      * with the index N. Braces are escaped by doubling them, i.e. "{{" and "}}".
+      * The messages are rendered into a thread local buffer without using C++ streams for the arguments of
+      * the built-in arithmetic and string types. Other types are printed using their output operator.
+      */
+    namespace fmt
+    {
+	/** Checks the given format string and returns the number of arguments it requires
+	  * or -1 if the string is malformed. This function can be evaluated at compile time.
+	  */
+	constexpr int arguments_count( std::string_view format )
+	{
+	    int automatic = 0;
+	    int manual = 0;
+	    bool has_manual = false;
+	    for ( size_t i = 0; i < format.size(); ++i )
+	    {
+		if ( format[i] == '{' )
+		{
+		    if ( i + 1 < format.size() && format[i + 1] == '{' )
+		    {
+			++i;
+			continue;
+		    }
+
+		    size_t j = i + 1;
+		    int index = 0;
+		    for ( ; j < format.size() && format[j] >= '0' && format[j] <= '9'; ++j )
+		    {
+			index = index * 10 + ( format[j] - '0' );
+		    }
+
+		    if ( j == format.size() || format[j] != '}' )
+			return -1;
+
+		    if ( j == i + 1 )
+		    {
+			++automatic;
+		    }
+		    else
+		    {
+			has_manual = true;
+			manual = index + 1 > manual ? index + 1 : manual;
+		    }
+		    i = j;
+		}
+		else if ( format[i] == '}' )
+		{
+		    if ( i + 1 < format.size() && format[i + 1] == '}' )
+		    {
+			++i;
+			continue;
+		    }
+		    return -1;
+		}
+	    }
+
+	    if ( has_manual && automatic )
+		return -1;
+
+	    return has_manual ? manual : automatic;
+	}
+
+	typedef void (*Appender)( std::string & out, const void * value );
+
+	void append( std::string & out, long long value );
+	void append( std::string & out, unsigned long long value );
+	void append( std::string & out, double value );
+	void append( std::string & out, const void * value );
+
+	template <class T>
+	void append_value( std::string & out, const void * pointer )
+	{
+	    const T & value = *static_cast<const T *>( pointer );
+
+	    if constexpr ( std::is_same_v<T, bool> )
+		out.append( value ? "true" : "false" );
+	    else if constexpr ( std::is_same_v<T, char> )
+		out.push_back( value );
+	    else if constexpr ( std::is_integral_v<T> && std::is_signed_v<T> )
+		append( out, static_cast<long long>( value ) );
+	    else if constexpr ( std::is_integral_v<T> )
+		append( out, static_cast<unsigned long long>( value ) );
+	    else if constexpr ( std::is_floating_point_v<T> )
+		append( out, static_cast<double>( value ) );
+	    else if constexpr ( std::is_same_v<std::decay_t<T>, const char *> || std::is_same_v<std::decay_t<T>, char *> )
+		out.append( value ? std::string_view( value ) : std::string_view( "(null)" ) );
+	    else if constexpr ( std::is_convertible_v<const T &, std::string_view> )
+		out.append( std::string_view( value ) );
+	    else if constexpr ( std::is_pointer_v<T> )
+		append( out, static_cast<const void *>( value ) );
+	    else
+	    {
+		std::ostringstream stream;
+		stream << value;
+		out.append( stream.str() );
+	    }
+	}
+
+	/** Substitutes the placeholders of the format string with the values and appends the result
+	  * to the given string. The format string must have been validated by \c arguments_count.
+	  */
+	void vformat_to( std::string & out, std::string_view format,
+			const void * const * values, const Appender * appenders, size_t count );
+
+	template <class ... Args>
+	void format_to( std::string & out, std::string_view format, const Args & ... args )
+	{
+	    const void * values[] = { static_cast<const void *>( &args ) ..., 0 };
+	    const Appender appenders[] = { &append_value<Args> ..., 0 };
+	    vformat_to( out, format, values, appenders, sizeof...( Args ) );
+	}
+
+	/** Provides a thread local string buffer for the message rendering. The buffer keeps its capacity
+	  * between subsequent uses, so in most cases rendering does not have to allocate memory.
+	  */
+	class Buffer
+	{
+	  public:
+	    Buffer();
+	    ~Buffer();
+
+	    std::string & str()
+	    { return *m_buffer; }
+
+	  private:
+	    Buffer( const Buffer & ) = delete;
+	    Buffer & operator=( const Buffer & ) = delete;
+
+	    std::string *	m_buffer;
+	    std::string		m_local;	/**< \brief used if the thread buffer is busy, e.g. for nested formatting */
+	};
+
+	template <int N, class ... Args>
+	std::string format( std::string_view format, const Args & ... args )
+	{
+	    static_assert( N >= 0, "ERS format string is malformed" );
+	    static_assert( N == sizeof...( Args ), "number of arguments does not match the ERS format string" );
+
+	    Buffer buffer;
+	    format_to( buffer.str(), format, args ... );
+	    return buffer.str();
+	}
+
+	/** The same as \c format, but renders the text into the given string, which is usually provided by
+	  * a Buffer object, and returns a view of it. The text can then be copied to its final destination
+	  * without creating an intermediate string.
+	  */
+	template <int N, class ... Args>
+	std::string_view format_view( std::string & out, std::string_view format, const Args & ... args )
+	{
+	    static_assert( N >= 0, "ERS format string is malformed" );
+	    static_assert( N == sizeof...( Args ), "number of arguments does not match the ERS format string" );
+
+	    format_to( out, format, args ... );
+	    return out;
+	}
+
+	/** This function is used for the issue messages, which do not have to refer to all the issue attributes.
+	  * The text is rendered into the given string and a view of it is returned.
+	  */
+	template <int N, class ... Args>
+	std::string_view format_attributes( std::string & out, std::string_view format, const Args & ... args )
+	{
+	    static_assert( N >= 0, "ERS format string is malformed" );
+	    static_assert( N <= sizeof...( Args ), "ERS format string refers to a non-existing issue attribute" );
+
+	    format_to( out, format, args ... );
+	    return out;
+	}
+    }
+}
+
+/** \def ERS_FORMAT( format, ... ) This macro returns the string produced by substituting the placeholders of the
+  * format string with the given arguments. The format string must be a literal, it is checked at compile time.
+  */
+#define ERS_FORMAT( ... ) \
+	ers::fmt::format<ers::fmt::arguments_count( BOOST_PP_VARIADIC_ELEM( 0, __VA_ARGS__ ) )>( __VA_ARGS__ )
+
+/** \def ERS_FORMAT_VIEW( out, format, ... ) The same as ERS_FORMAT, but the text is rendered into the given
+  * string and the macro returns a view of it.
+  */
+#define ERS_FORMAT_VIEW( out, ... ) \
+	ers::fmt::format_view<ers::fmt::arguments_count( BOOST_PP_VARIADIC_ELEM( 0, __VA_ARGS__ ) )>( out, __VA_ARGS__ )
+
+#endif
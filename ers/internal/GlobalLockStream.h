@@ -32,6 +32,8 @@ namespace ers
     struct GlobalLockStream : public OutputStream
     {
 	void write( const Issue & issue ) override;
+
+	void write_batch( const Issue * const * issues, size_t count ) override;
         
       private:
 	static std::mutex mutex_;
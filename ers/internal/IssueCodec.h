@@ -0,0 +1,64 @@
+/*
+ *  IssueCodec.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file IssueCodec.h This file defines functions for serializing issues into binary frames and JSON records.
+  * \brief ers header file
+  */
+
+#ifndef ERS_ISSUE_CODEC_H
+#define ERS_ISSUE_CODEC_H
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+namespace ers
+{
+    class Issue;
+
+    /** This namespace contains functions, which convert issues into self contained records and back. Such records
+      * can be stored to files or sent to other processes, which can rebuild the original issues, including their
+      * context, attributes and the chain of causes.
+      *
+      * A binary frame consists of a 32 bit length of the frame body followed by the body itself. All numbers are
+      * written in the native byte order, therefore binary frames can be decoded only on a host with the same byte
+      * order. A binary file starts with the \c BinaryMagic header. Stack frames are stored as module relative
+      * records (see ers::Frame), so they can be resolved by the ers_symbolize utility on any host.
+      *
+      * A JSON record is a single line, which contains a JSON object and is terminated by the new line character.
+      */
+    namespace codec
+    {
+	const char BinaryMagic[] = "ERS-BIN2";		/**< \brief header of a binary file */
+	const size_t BinaryMagicSize = sizeof( BinaryMagic ) - 1;
+
+	/** Appends the binary frame for the given issue to the string. */
+	void encode_binary( const Issue & issue, std::string & out );
+
+	/** Decodes the binary frame, which starts at the given position, and advances the position to the next frame.
+	  * \return new issue or null pointer if the frame is malformed or truncated
+	  */
+	Issue * decode_binary( const char * & data, const char * end );
+
+	/** Returns the total size of the binary frame, which starts at the given position, without decoding it.
+	  * \return frame size or 0 if the frame is truncated
+	  */
+	size_t binary_frame_size( const char * data, const char * end );
+
+	/** Appends the JSON record for the given issue to the string. */
+	void encode_json( const Issue & issue, std::string & out );
+
+	/** Decodes the JSON record, the terminating new line character is optional.
+	  * \return new issue or null pointer if the record is malformed
+	  */
+	Issue * decode_json( std::string_view record );
+    }
+}
+
+#endif
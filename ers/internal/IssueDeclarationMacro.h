@@ -34,7 +34,7 @@
 
 #define ERS_ATTRIBUTE_ACCESSORS( _, __, tuple ) \
 	ERS_TYPE(tuple) \
-	BOOST_PP_CAT( get_, ERS_NAME(tuple) ) () { \
+	BOOST_PP_CAT( get_, ERS_NAME(tuple) ) () const { \
 		ERS_TYPE(tuple) val; \
 		ers::Issue::get_value( BOOST_PP_STRINGIZE(ERS_NAME(tuple)), val ); \
 		return val; \
@@ -45,6 +45,15 @@
 	out << message;\
 	prepend_message( out.str() );
 
+#define ERS_SET_STREAMED_MESSAGE( message, base_attributes, attributes ) \
+	ERS_SET_MESSAGE( message )
+
+#define ERS_SET_FORMATTED_MESSAGE( format, base_attributes, attributes ) \
+	ers::fmt::Buffer ers_format_buffer; \
+	prepend_message( ers::fmt::format_attributes<ers::fmt::arguments_count( format )>( ers_format_buffer.str(), format \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, base_attributes ) \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, attributes ) ) );
+
 #define	ERS_PRINT_LIST( decl, attributes ) \
 	BOOST_PP_SEQ_FOR_EACH( decl, _, attributes )
 
@@ -73,14 +82,31 @@ namespace namespace_name { \
         	    ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
                     ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY attributes ), \
                     const std::exception & cause ); \
+	class_name( const ers::Context & context, \
+        	    const std::string & msg \
+        	    ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
+                    ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY attributes ), \
+                    ers::Issue && cause ); \
+	class_name( const ers::Context & context \
+        	    ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
+                    ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY attributes ), \
+                    ers::Issue && cause ); \
+	class_name( const class_name & ) = default; \
+	class_name( class_name && ) = default; \
 	void raise() const { throw class_name(*this); } \
+	void move_raise() { throw class_name( std::move( *this ) ); } \
 	const char * get_class_name() const { return get_uid(); } \
 	base_class_name * clone() const { return new namespace_name::class_name( *this ); } \
+	base_class_name * move_clone() { return new namespace_name::class_name( std::move( *this ) ); } \
 	ERS_PRINT_LIST( ERS_ATTRIBUTE_ACCESSORS, ERS_EMPTY attributes ) \
     }; \
 }
 
 #define __ERS_DEFINE_ISSUE_BASE__( INLINE, namespace_name, class_name, base_class_name, message, base_attributes, attributes ) \
+	__ERS_DEFINE_ISSUE_IMPL__( INLINE, ERS_SET_STREAMED_MESSAGE, namespace_name, class_name, base_class_name, \
+		ERS_EMPTY message, ERS_EMPTY base_attributes, ERS_EMPTY attributes )
+
+#define __ERS_DEFINE_ISSUE_IMPL__( INLINE, setter, namespace_name, class_name, base_class_name, message, base_attributes, attributes ) \
 namespace namespace_name { \
     INLINE class_name::class_name( const ers::Context & context \
 		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
@@ -88,7 +114,7 @@ namespace namespace_name { \
       : base_class_name( context ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, ERS_EMPTY base_attributes ) ) \
     { \
       ERS_PRINT_LIST( ERS_ATTRIBUTE_SERIALIZATION, ERS_EMPTY attributes ) \
-      BOOST_PP_EXPR_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY message ) ), ERS_SET_MESSAGE( ERS_EMPTY message ) )\
+      BOOST_PP_EXPR_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY message ) ), setter( ERS_EMPTY message, ERS_EMPTY base_attributes, ERS_EMPTY attributes ) )\
     } \
     \
     INLINE class_name::class_name( const ers::Context & context, \
@@ -116,7 +142,26 @@ namespace namespace_name { \
       : base_class_name( context ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, ERS_EMPTY base_attributes ), cause ) \
     { \
       ERS_PRINT_LIST( ERS_ATTRIBUTE_SERIALIZATION, ERS_EMPTY attributes ) \
-      BOOST_PP_EXPR_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY message ) ), ERS_SET_MESSAGE( ERS_EMPTY message ) )\
+      BOOST_PP_EXPR_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY message ) ), setter( ERS_EMPTY message, ERS_EMPTY base_attributes, ERS_EMPTY attributes ) )\
+    } \
+    \
+    INLINE class_name::class_name( const ers::Context & context, \
+		const std::string & msg \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY attributes ), \
+		ers::Issue && cause ) \
+      : base_class_name( context, msg ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, ERS_EMPTY base_attributes ), std::move( cause ) ) \
+    { \
+      ERS_PRINT_LIST( ERS_ATTRIBUTE_SERIALIZATION, ERS_EMPTY attributes ) \
+    } \
+    INLINE class_name::class_name( const ers::Context & context \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY base_attributes ) \
+		ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME_TYPE, ERS_EMPTY attributes ), \
+		ers::Issue && cause ) \
+      : base_class_name( context ERS_PRINT_LIST( ERS_ATTRIBUTE_NAME, ERS_EMPTY base_attributes ), std::move( cause ) ) \
+    { \
+      ERS_PRINT_LIST( ERS_ATTRIBUTE_SERIALIZATION, ERS_EMPTY attributes ) \
+      BOOST_PP_EXPR_IF( BOOST_PP_NOT( ERS_IS_EMPTY( ERS_EMPTY message ) ), setter( ERS_EMPTY message, ERS_EMPTY base_attributes, ERS_EMPTY attributes ) )\
     } \
 } \
 namespace { \
@@ -143,4 +188,25 @@ namespace { \
 	__ERS_DECLARE_ISSUE_BASE__( namespace_name, class_name, ers::Issue, ERS_EMPTY message, ERS_EMPTY, attributes ) \
         __ERS_DEFINE_ISSUE_BASE__( inline, namespace_name, class_name, ers::Issue, ERS_EMPTY message, ERS_EMPTY, attributes )
 
+/** The following macros declare issues, whose message is given by a format string (see ers/internal/Format.h)
+  * instead of a sequence of output operators. The "{N}" placeholders of the format string are replaced with the
+  * issue attributes, the base class attributes go first. E.g.
+  *
+  *     ERS_DECLARE_ISSUE_FMT( ers, CantOpenFile, "Can not open \"{0}\" file", ((std::string)file_name) )
+  */
+#define ERS_DEFINE_ISSUE_BASE_FMT_CXX( namespace_name, class_name, base_class_name, format, base_attributes, attributes ) \
+	__ERS_DEFINE_ISSUE_IMPL__( ERS_EMPTY, ERS_SET_FORMATTED_MESSAGE, namespace_name, class_name, base_class_name, \
+		format, ERS_EMPTY base_attributes, ERS_EMPTY attributes )
+
+#define ERS_DEFINE_ISSUE_FMT_CXX( namespace_name, class_name, format, attributes ) \
+	ERS_DEFINE_ISSUE_BASE_FMT_CXX( namespace_name, class_name, ers::Issue, format, ERS_EMPTY, ERS_EMPTY attributes )
+
+#define ERS_DECLARE_ISSUE_BASE_FMT( namespace_name, class_name, base_class_name, format, base_attributes, attributes ) \
+	__ERS_DECLARE_ISSUE_BASE__( namespace_name, class_name, base_class_name, format, base_attributes, attributes ) \
+	__ERS_DEFINE_ISSUE_IMPL__( inline, ERS_SET_FORMATTED_MESSAGE, namespace_name, class_name, base_class_name, \
+		format, base_attributes, attributes )
+
+#define ERS_DECLARE_ISSUE_FMT( namespace_name, class_name, format, attributes ) \
+	ERS_DECLARE_ISSUE_BASE_FMT( namespace_name, class_name, ers::Issue, format, ERS_EMPTY, attributes )
+
 #endif
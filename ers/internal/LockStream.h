@@ -36,6 +36,8 @@ namespace ers
     struct LockStream : public OutputStream
     {
 	void write( const Issue & issue ) override;
+
+	void write_batch( const Issue * const * issues, size_t count ) override;
         
       private:
 	std::mutex m_mutex;
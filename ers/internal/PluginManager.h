@@ -17,6 +17,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace ers
 {
@@ -55,17 +56,31 @@ namespace ers
 	};
 
 	typedef std::map< std::string, SharedLibrary* > LibMap;
+	typedef std::map< std::string, std::string > Manifest;
 
-	LibMap	    libraries_;
+	LibMap			    libraries_;
+	Manifest		    manifest_;	/**< \brief maps stream names to the libraries implementing them */
+	std::vector<std::string>    unlisted_;	/**< \brief libraries which streams are not known in advance */
+
+	bool load( const std::string & name );
 
       public:
-	/** Constructor loads the plugins.
+	/** Constructor reads the stream manifest and the TDAQ_ERS_STREAM_LIBS environment variable,
+	    but does not load any library. Each element of this variable is either a library name or
+	    has the "library=stream1,stream2" form, which tells which streams this library implements.
 	 */
 	PluginManager();
 
 	/** Destructor unloads the plugins.
 	 */
 	~PluginManager();
+
+	/** Loads the library which implements the given stream. If the stream is not in the manifest
+	    all libraries with unknown contents are loaded.
+	    @param stream Name of the stream
+	    @return true if a new library has been loaded
+	 */
+	bool load_stream( const std::string & stream );
     };
 }
 
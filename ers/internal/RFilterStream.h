@@ -42,6 +42,8 @@ namespace ers
 	RFilterStream( const std::string & format ); 
 	
         void write( const Issue & issue ) override;
+
+        void write_batch( const Issue * const * issues, size_t count ) override;
         
       private:	    
         bool is_accepted( const ers::Issue & issue );
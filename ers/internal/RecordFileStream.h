@@ -0,0 +1,75 @@
+/*
+ *  RecordFileStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file RecordFileStream.h This file defines the ERS streams, which record issues to binary and JSON files.
+  * \brief ers header file
+  */
+
+#ifndef ERS_RECORD_FILE_STREAM_H
+#define ERS_RECORD_FILE_STREAM_H
+
+#include <mutex>
+#include <string_view>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class appends issues to a file as self contained records, which preserve all the issue
+      * attributes, the context and the chain of causes. Such files can be replayed later with the "file"
+      * input stream, which reconstructs the original issues. See ers/internal/IssueCodec.h for the
+      * description of the record formats.
+      *
+      * \brief Base class for the recording file streams.
+      */
+
+    class RecordFileStream : public OutputStream
+    {
+      public:
+	typedef void (*Encoder)( const Issue & issue, std::string & out );
+
+        ~RecordFileStream();
+
+        void write( const Issue & issue ) override;
+
+        void write_batch( const Issue * const * issues, size_t count ) override;
+
+      protected:
+	RecordFileStream( const std::string & file_name, Encoder encoder, std::string_view header );
+
+      private:
+	int		m_fd;
+	Encoder		m_encoder;
+	std::mutex	m_mutex;
+    };
+
+    /** This stream writes issues as binary frames. In order to employ this implementation in a stream
+      * configuration the name to be used is "bfile" and the only parameter is the name of the file, e.g.
+      *
+      *         export TDAQ_ERS_ERROR="lstderr,bfile(errors.bin)"
+      *
+      * The \c BinaryMagic header is written to the beginning of the file when it is created.
+      * \brief Binary recording file stream.
+      */
+    struct BinaryFileStream : public RecordFileStream
+    {
+	explicit BinaryFileStream( const std::string & file_name );
+    };
+
+    /** This stream writes issues as JSON records, one per line. In order to employ this implementation
+      * in a stream configuration the name to be used is "jfile" and the only parameter is the name of the file.
+      * \brief JSON recording file stream.
+      */
+    struct JsonFileStream : public RecordFileStream
+    {
+	explicit JsonFileStream( const std::string & file_name );
+    };
+}
+
+#endif
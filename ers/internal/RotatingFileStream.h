@@ -0,0 +1,95 @@
+/*
+ *  RotatingFileStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file RotatingFileStream.h This file defines RotatingFileStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_ROTATING_FILE_STREAM_H
+#define ERS_ROTATING_FILE_STREAM_H
+
+#include <condition_variable>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class implements a thread-safe file stream, which splits its output into a sequence of files.
+      * In order to employ this implementation in a stream configuration the name to be used is "rfile".
+      * E.g. the following configuration will write the ERROR stream to the "error.log" file which is
+      * rotated whenever it grows beyond 10 MB or once per hour, keeping at most 5 files:
+      *
+      *         export TDAQ_ERS_ERROR="rfile(error.log,10M,5,3600)"
+      *
+      * This stream has four configuration parameters:
+      *   - path of the active file; older files are renamed to path.1, path.2, ...
+      *   - maximum size of a file in bytes, K, M and G suffixes are accepted (default is 100M)
+      *   - maximum number of files including the active one (default is 10)
+      *   - maximum age of the active file in seconds, 0 disables time based rotation (default is 0)
+      *
+      * A path must be used by a single stream, since the streams rotate their files independently.
+      * The streams configured for different severities must therefore write to different paths.
+      *
+      * The next file is created and preallocated in advance by a background thread, which also does all
+      * the renaming and removal of old files. Rotation therefore only swaps the active file pointer in the
+      * context of the writing thread.
+      *
+      * \brief Rotating file stream.
+      */
+
+    class RotatingFileStream : public OutputStream
+    {
+      public:
+	explicit RotatingFileStream( const std::string & format );
+
+        ~RotatingFileStream();
+
+        void write( const Issue & issue ) override;
+
+      private:
+	struct Segment
+        {
+            explicit Segment( const std::string & name, off_t preallocate );
+            ~Segment();
+
+            int		m_fd;		/**< \brief file descriptor */
+	    off_t	m_size;		/**< \brief number of bytes written to the file */
+            std::time_t m_opened;	/**< \brief time when the file has been opened */
+        };
+
+	std::string segment_name( int index ) const;
+
+        void rotate( std::unique_ptr<Segment> & retired );
+
+	void thread_wrapper();
+
+      private:
+	std::string			m_path;
+	off_t				m_max_size;
+	int				m_max_files;
+	int				m_interval;
+
+	std::mutex			m_write_mutex;
+	std::unique_ptr<Segment>	m_active;	/**< \brief file which is currently written */
+
+	std::mutex			m_mutex;
+	std::condition_variable		m_condition;
+	std::unique_ptr<Segment>	m_next;		/**< \brief preallocated file to be used after rotation */
+	std::queue<std::unique_ptr<Segment> > m_retired;	/**< \brief files waiting for being renamed */
+	bool				m_terminated;
+	std::thread			m_thread;
+    };
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ *  SampleStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file SampleStream.h This file defines SampleStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_SAMPLE_STREAM_H
+#define ERS_SAMPLE_STREAM_H
+
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class passes a deterministic fraction of issues to the next stream. In order to employ this
+      * implementation in a stream configuration the name to be used is "sample", e.g.
+      *
+      *         export TDAQ_ERS_DEBUG="sample(0.01,5),lstdout"
+      *
+      * This stream has two configuration parameters:
+      *   - fraction of issues which are passed through, a number between 0 and 1
+      *   - number of issues from every source (default is 1), which are always passed through within each
+      *         minute, so that rare sources are represented in the sample
+      *
+      * A source is identified by the issue class and the file and line where the issue has been created.
+      * The decision for an issue is made by hashing its source together with the sequence number of the issue
+      * from this source, so replicas of an application, which report the same issues, keep the same sample.
+      * The sources are counted in a table of a fixed size. Every forwarded issue gets the "sample_rate"
+      * parameter, which is 1 for the issues passed unconditionally and the configured fraction for the others.
+      *
+      * \brief Deterministic sampling stream.
+      */
+
+    class SampleStream : public OutputStream
+    {
+      public:
+	explicit SampleStream( const std::string & format );
+
+        void write( const Issue & issue ) override;
+
+      private:
+	struct Source
+        {
+            uint64_t	m_key;
+            uint64_t	m_sequence;
+            std::time_t	m_window;
+        };
+
+      private:
+	double			m_rate;
+	uint64_t		m_threshold;	/**< \brief hash values below this one are accepted */
+	uint64_t		m_per_site;
+
+	std::mutex		m_mutex;
+	std::vector<Source>	m_sources;
+    };
+}
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ *  ShmInputStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file ShmInputStream.h This file defines ShmInputStream ERS input stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_SHM_INPUT_STREAM_H
+#define ERS_SHM_INPUT_STREAM_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <ers/InputStream.h>
+#include <ers/internal/ShmRing.h>
+
+namespace ers
+{
+
+    /** This class drains the shared memory ring, which is filled by the "shm" output streams of other processes.
+      * Only one collector can be attached to a ring at a time. In order to employ this implementation the name
+      * to be used is "shm", e.g.
+      *
+      *         ers::StreamManager::instance().add_receiver( "shm", { "ers_node", "1000" }, &receiver );
+      *
+      * This stream has three parameters:
+      *   - name of the shared memory segment, which is created if it does not exist
+      *   - time in milliseconds (default is 1000) after which a slot, claimed by a producer that has not
+      *         started writing into it, is considered abandoned and is skipped
+      *   - octal permissions of the segment if it is created (default is 0600)
+      * The numbers of issues dropped by the producers and of the reclaimed slots are reported every minute
+      * if they have grown.
+      *
+      * \brief Collects issues from the shared memory ring.
+      */
+
+    class ShmInputStream : public InputStream
+    {
+      public:
+	explicit ShmInputStream( const std::initializer_list<std::string> & params );
+
+        ~ShmInputStream();
+
+      protected:
+	void start() override;
+
+      private:
+	void run();
+
+	void report_losses();
+
+      private:
+	std::unique_ptr<ShmRing>	m_ring;
+	std::chrono::milliseconds	m_timeout;
+	uint64_t			m_dropped;		/**< \brief dropped issues at the last report */
+	uint64_t			m_reclaimed;		/**< \brief reclaimed slots at the last report */
+	std::atomic<bool>		m_terminated;
+	std::thread			m_thread;
+    };
+}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ *  ShmRing.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file ShmRing.h This file defines the shared memory ring buffer used by the "shm" streams.
+  * \brief ers header file
+  */
+
+#ifndef ERS_SHM_RING_H
+#define ERS_SHM_RING_H
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <ers/Issue.h>
+
+/** \def ers::BadShmConfiguration This issue is reported when a parameter of the "shm" stream is not
+  * a valid unsigned number or permissions mode.
+  */
+ERS_DECLARE_ISSUE_HPP(	ers,
+			BadShmConfiguration,
+			"The \"" << parameter << "\" parameter of the shm stream is invalid.",
+			((std::string)parameter) )
+
+namespace ers
+{
+
+    /** This class implements a bounded multi-producer single-consumer queue of records, which resides in a named
+      * POSIX shared memory segment, so it can be used by several processes. The segment is created by the first
+      * process which opens it and persists until it is explicitly removed, which allows the processes to be
+      * restarted in any order.
+      *
+      * The queue consists of a fixed number of slots of the same size, each holding a single record, and is based
+      * on the bounded queue algorithm of D. Vyukov: producers claim slots by incrementing the shared enqueue position
+      * and use per-slot sequence numbers to publish the records. In order to survive producers dying while writing
+      * a record each producer stores its identity, i.e. its pid and start time, in the slot and then marks the slot
+      * as busy. The consumer reclaims a busy slot only if its owner has provably terminated, since a stalled producer
+      * would otherwise overwrite the next record written to the slot. A claimed slot, which has not been marked busy
+      * within the given timeout, is reclaimed as well. A producer, whose slot has been reclaimed, drops its record.
+      * The identities can be checked only if all the processes using the ring share the same pid namespace.
+      *
+      * \brief Shared memory multi-process ring buffer.
+      */
+
+    class ShmRing
+    {
+      public:
+	static const size_t DefaultCapacity = 4096;
+	static const size_t DefaultSlotSize = 2048;
+	static const mode_t DefaultMode = 0600;
+
+	/** Opens the segment with the given name or creates it with the given geometry if it does not exist.
+	  * \param mode permissions of the segment if it is created, which are further restricted by the umask.
+	  *		The default mode allows only the processes of the same user to read and write the records.
+	  * \throw ers::CantOpenFile if the segment can not be opened or is not a valid ring
+	  */
+	ShmRing( const std::string & name, size_t capacity = DefaultCapacity, size_t slot_size = DefaultSlotSize,
+		 mode_t mode = DefaultMode );
+
+	~ShmRing();
+
+	/** Copies the record into the ring.
+	  * \return false if the record is too large or the ring is full, in which case the record is counted as dropped
+	  */
+	bool push( const char * data, size_t size );
+
+	/** Reads the oldest record, which can be called by a single collector at a time.
+	  * \return false if no record is available at the moment
+	  */
+	bool pop( std::string & record, std::chrono::steady_clock::duration timeout );
+
+	/** Registers the calling process as the collector of this ring.
+	  * \return false if another living process is already registered
+	  */
+	bool attach_collector();
+
+	void detach_collector();
+
+	const std::string & name() const
+	{ return m_name; }
+
+	size_t max_record_size() const;
+
+	uint64_t dropped() const;			/**< \return number of records dropped by all producers */
+
+	uint64_t reclaimed() const;			/**< \return number of slots reclaimed from stalled or dead producers */
+
+	/** Parses a numeric parameter of the "shm" streams.
+	  * \throw ers::BadShmConfiguration if the value is not an unsigned number
+	  */
+	static size_t parse_parameter( const std::string & value );
+
+	/** Parses the octal permissions parameter of the "shm" streams, e.g. "0660".
+	  * \throw ers::BadShmConfiguration if the value is not a valid mode
+	  */
+	static mode_t parse_mode( const std::string & value );
+
+      private:
+	ShmRing( const ShmRing & ) = delete;
+	ShmRing & operator=( const ShmRing & ) = delete;
+
+	struct Header;
+	struct Slot;
+
+	Slot & slot( uint64_t position ) const;
+
+	bool reclaim( Slot & slot, uint64_t sequence, uint64_t position, uint64_t owner );
+
+      private:
+	std::string		m_name;
+	Header *		m_header;
+	size_t			m_size;
+	uint64_t		m_stalled_position;	/**< \brief collector only: claimed position which is not yet busy */
+	std::chrono::steady_clock::time_point	m_stalled_since;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ *  ShmStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file ShmStream.h This file defines ShmStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_SHM_STREAM_H
+#define ERS_SHM_STREAM_H
+
+#include <ers/OutputStream.h>
+#include <ers/internal/ShmRing.h>
+
+namespace ers
+{
+
+    /** This class writes issues into a shared memory ring, which is drained by a single collector process,
+      * e.g. the \c ers_collect utility. Reporting an issue costs no system calls, which makes this stream
+      * suitable for processes with the highest reporting rates. In order to employ this implementation in a
+      * stream configuration the name to be used is "shm", e.g.
+      *
+      *         export TDAQ_ERS_LOG="shm(ers_node)"
+      *
+      * This stream has four configuration parameters:
+      *   - name of the shared memory segment
+      *   - number of slots in the ring (default is 4096), which is rounded up to a power of two
+      *   - size of a slot in bytes (default is 2048)
+      *   - octal permissions of the segment (default is 0600, i.e. only the same user can use the ring)
+      * The last three parameters are used only by the process which creates the segment. Issues, which do not
+      * fit into a slot or can not be written because the ring is full, are dropped and counted. The number
+      * of issues dropped by this stream is reported when the stream is destroyed.
+      *
+      * \brief Shared memory multi-process stream.
+      */
+
+    class ShmStream : public OutputStream
+    {
+      public:
+	explicit ShmStream( const std::string & format );
+
+	~ShmStream();
+
+        void write( const Issue & issue ) override;
+
+      private:
+	std::unique_ptr<ShmRing>	m_ring;
+	std::atomic<uint64_t>		m_dropped;
+    };
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 #include <ers/OutputStream.h>
 #include <ers/StandardStreamOutput.h>
+#include <ers/internal/Format.h>
 
 namespace ers
 {
@@ -41,11 +42,38 @@ namespace ers
           : Device ( file_name )
         { ; }
         
+        /** The issue is rendered into a thread local buffer before the device is locked,
+	  * so the lock is held only while the text is written to the stream.
+	  */
         void write( const Issue & issue )
 	{
-	    println( device().stream(), issue, Configuration::instance().verbosity_level() );
+	    {
+		ers::fmt::Buffer buffer;
+		print( buffer.str(), issue, Configuration::instance().verbosity_level() );
+		buffer.str().push_back( '\n' );
+		auto && d = device();
+		d.stream().write( buffer.str().data(), buffer.str().size() ).flush();
+	    }
 	    chained().write( issue );
 	}
+
+	/** Renders all the issues into a single buffer and writes it holding the device lock once.
+	  */
+	void write_batch( const Issue * const * issues, size_t count )
+	{
+	    {
+		int verbosity = Configuration::instance().verbosity_level();
+		ers::fmt::Buffer buffer;
+		for ( size_t i = 0; i < count; ++i )
+		{
+		    print( buffer.str(), *issues[i], verbosity );
+		    buffer.str().push_back( '\n' );
+		}
+		auto && d = device();
+		d.stream().write( buffer.str().data(), buffer.str().size() ).flush();
+	    }
+	    chained().write_batch( issues, count );
+	}
     };
 }
     
@@ -0,0 +1,104 @@
+/*
+ *  Symbolizer.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file Symbolizer.h This file defines the ers::Symbolizer class, which translates stack frame
+  * addresses either into symbolic names or into module relative records for offline symbolization.
+  * \brief ers header file
+  */
+
+#ifndef ERS_SYMBOLIZER_H
+#define ERS_SYMBOLIZER_H
+
+#include <stdint.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ers
+{
+    template <class > class SingletonCreator;
+
+    /** Describes a stack frame in a way, which is independent of the address space of the process.
+      * Such records can be resolved offline by the ers_symbolize utility, which uses the build id
+      * to verify that the module on disk is the one, which was loaded by the process.
+      */
+    struct Frame
+    {
+	std::string	m_module;	/**< \brief path of the shared object or executable */
+	std::string	m_build_id;	/**< \brief hex encoded GNU build id of the module, may be empty */
+	uintptr_t	m_offset;	/**< \brief address relative to the module load address */
+    };
+
+    std::ostream & operator<<( std::ostream & out, const Frame & frame );
+
+    /** This class resolves stack frame addresses. Symbolic names are cached, so every distinct address
+      * is demangled only once during the process life time, no matter how many times it is printed.
+      */
+    class Symbolizer
+    {
+	template <class > friend class SingletonCreator;
+
+      public:
+	static Symbolizer & instance();
+
+	/** \return symbolic name of the given address in the "module(function+offset) [address]" form */
+	const std::string & symbol( void * address );
+
+	/** \return module relative record for the given address */
+	Frame frame( void * address );
+
+	/** Calls the given function with the module path, the module build id and the module relative offset
+	  * of each of the given addresses. Unlike frame() this function does not copy the module attributes.
+	  */
+	template <class F>
+	void visit( void * const * addresses, int size, F function );
+
+      private:
+	struct Module
+	{
+	    uintptr_t	m_begin;
+	    uintptr_t	m_end;
+	    uintptr_t	m_base;
+	    std::string	m_path;
+	    std::string	m_build_id;
+	};
+
+	Symbolizer() = default;
+
+	const Module * find_module( uintptr_t address ) const;
+	const Module * lookup_module( uintptr_t address );
+	void load_modules();
+	static unsigned long long modules_generation();
+
+      private:
+	std::mutex					m_mutex;
+	std::unordered_map<void *, std::string>		m_symbols;
+	std::vector<Module>				m_modules;
+	unsigned long long				m_generation = ~0ull;	/**< \brief modules loaded and unloaded at the last scan */
+    };
+}
+
+template <class F>
+void
+ers::Symbolizer::visit( void * const * addresses, int size, F function )
+{
+    static const std::string empty;
+    std::scoped_lock lock( m_mutex );
+    for ( int i = 0; i < size; ++i )
+    {
+	uintptr_t address = (uintptr_t)addresses[i];
+	if ( const Module * module = lookup_module( address ) )
+	    function( module->m_path, module->m_build_id, address - module->m_base );
+	else
+	    function( empty, empty, address );
+    }
+}
+
+#endif
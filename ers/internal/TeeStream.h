@@ -0,0 +1,103 @@
+/*
+ *  TeeStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file TeeStream.h This file defines TeeStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_TEE_STREAM_H
+#define ERS_TEE_STREAM_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class passes issues to several independent chains of streams, each of them running in its own
+      * thread. In order to employ this implementation in a stream configuration the name to be used is "tee"
+      * and its parameters are stream chains separated by the '|' character, e.g.
+      *
+      *         export TDAQ_ERS_ERROR="tee(lfile(errors.log) | queue(100,drop_old),uds(/tmp/ers.sock)),lstderr"
+      *
+      * Each branch has a bounded queue, which is configured by the optional "queue(capacity, policy)" element
+      * at the beginning of the branch. The capacity must be a positive number, the default is 1024 issues. An invalid
+      * element makes the constructor throw ers::BadTeeConfiguration. The policy defines what happens
+      * when the queue is full:
+      *   - "drop_new" (default) - the new issue is dropped
+      *   - "drop_old" - the oldest queued issue is dropped
+      *   - "block" - the reporting thread waits until the branch processes some issues
+      *
+      * A slow branch therefore never delays the other branches, and with one of the dropping policies it does
+      * not delay the reporting thread either. Issues are passed to the branch streams in batches. Fatal issues
+      * are written synchronously: the reporting thread waits until all branches have processed them.
+      * The issue is also passed to the stream which follows the tee stream in the configuration.
+      *
+      * \brief Parallel fan-out stream.
+      */
+
+    class TeeStream : public OutputStream
+    {
+      public:
+	enum Policy { DropNew, DropOld, Block };
+
+	struct Statistics
+        {
+            uint64_t	m_enqueued;
+            uint64_t	m_written;
+            uint64_t	m_dropped;
+        };
+
+	explicit TeeStream( const std::string & format );
+
+        ~TeeStream();
+
+        void write( const Issue & issue ) override;
+
+	size_t branches() const
+	{ return m_branches.size(); }
+
+	Statistics statistics( size_t branch ) const;	/**< \brief returns counters of the given branch */
+
+      private:
+	struct Branch
+        {
+            Branch( OutputStream * head, size_t capacity, Policy policy );
+
+            ~Branch();
+
+            void push( const std::shared_ptr<const Issue> & issue, bool wait );
+
+            void run();
+
+            std::unique_ptr<OutputStream>			m_head;
+            size_t						m_capacity;
+            Policy						m_policy;
+
+            mutable std::mutex					m_mutex;
+            std::condition_variable				m_condition;
+            std::deque<std::shared_ptr<const Issue> >		m_queue;
+            bool						m_terminated;
+            Statistics						m_statistics;
+            uint64_t						m_processed;	/**< \brief enqueued and dropped issues, which are done */
+            std::thread						m_thread;
+        };
+
+      private:
+	std::vector<std::unique_ptr<Branch> >	m_branches;
+    };
+}
+
+#endif
@@ -12,6 +12,7 @@
 
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include <ers/OutputStream.h>
 
@@ -37,6 +38,8 @@ namespace ers
 
         void write(const ers::Issue &issue) override;
 
+        void write_batch(const ers::Issue * const * issues, size_t count) override;
+
     private:
         class IssueRecord {
         public:
@@ -56,12 +59,17 @@ namespace ers
 
         void reportSuppression(IssueRecord &record, const ers::Issue &issue);
 
+        void pass(const ers::Issue &issue);
+
+        void flush();
+
         typedef std::map<std::string, IssueRecord> IssueMap;
         IssueMap m_issueMap;
 
         int m_initialThreshold;
         int m_timeLimit;
         std::mutex m_mutex;
+        std::vector<const ers::Issue *> *m_batch; /**< \brief collects accepted issues while a batch is processed */
     };
 }
 
@@ -0,0 +1,88 @@
+/*
+ *  TopKStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file TopKStream.h This file defines TopKStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_TOPK_STREAM_H
+#define ERS_TOPK_STREAM_H
+
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class finds the sources, which report the largest numbers of issues. A source is identified by the
+      * issue class and the file and line where the issue has been created. All issues are passed to the next
+      * stream unchanged and at the end of each time interval this stream also passes a summary issue, which lists
+      * the K most frequent sources of this interval together with their reporting rates. In order to employ this
+      * implementation in a stream configuration the name to be used is "topk", e.g.
+      *
+      *         export TDAQ_ERS_LOG="topk(10,60),lstdout"
+      *
+      * This stream has two configuration parameters:
+      *   - number of sources in the summary (default is 10)
+      *   - length of the interval in seconds (default is 60)
+      *
+      * The sources are counted with the space-saving algorithm, which keeps a fixed number of counters, so the
+      * memory used by this stream does not depend on the number of distinct sources. If there are more sources
+      * than counters the reported counts may be overestimated by at most the value shown as the error. The
+      * interval is measured using issue times, so the summary is produced by the first issue reported after
+      * the end of the interval.
+      *
+      * \brief Reports the noisiest issue sources.
+      */
+
+    class TopKStream : public OutputStream
+    {
+      public:
+	explicit TopKStream( const std::string & format );
+
+        void write( const Issue & issue ) override;
+
+      private:
+	struct Counter
+        {
+            uint64_t	m_key;
+            uint64_t	m_count;
+            uint64_t	m_error;	/**< \brief maximum overestimation of the count */
+            std::string	m_source;
+        };
+
+	void count( uint64_t key, const Issue & issue );
+
+	void sift_down( size_t position );
+
+	void sift_up( size_t position );
+
+	void swap( size_t a, size_t b );
+
+	std::unique_ptr<Issue> report( const Issue & issue, unsigned int elapsed );
+
+      private:
+	size_t					m_k;
+	unsigned int				m_interval;
+	size_t					m_capacity;
+	std::time_t				m_start;
+
+	std::mutex				m_mutex;
+	std::vector<Counter>			m_heap;		/**< \brief min-heap of counters ordered by count */
+	std::unordered_map<uint64_t, size_t>	m_index;	/**< \brief key to the heap position */
+    };
+}
+
+#endif
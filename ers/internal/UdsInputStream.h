@@ -0,0 +1,56 @@
+/*
+ *  UdsInputStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file UdsInputStream.h This file defines UdsInputStream ERS input stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_UDS_INPUT_STREAM_H
+#define ERS_UDS_INPUT_STREAM_H
+
+#include <string>
+#include <thread>
+
+#include <ers/InputStream.h>
+
+namespace ers
+{
+
+    /** This class receives issues, which are sent by the "uds" output streams of other processes running
+      * on the same node. In order to employ this implementation the name to be used is "uds" and the only
+      * parameter is the path of the socket, which is created by this stream and removed by its destructor, e.g.
+      *
+      *         ers::StreamManager::instance().add_receiver( "uds", "/tmp/ers.sock", &receiver );
+      *
+      * Issues are delivered to the receiver by a dedicated thread in the order in which they have been received.
+      *
+      * \brief Collects issues from the processes of the current node.
+      */
+
+    class UdsInputStream : public InputStream
+    {
+      public:
+	explicit UdsInputStream( const std::initializer_list<std::string> & params );
+
+        ~UdsInputStream();
+
+      protected:
+	void start() override;
+
+      private:
+	void run();
+
+      private:
+	std::string	m_path;
+	int		m_fd;
+	int		m_wakeup;	/**< \brief eventfd used to interrupt the receiving thread */
+	std::thread	m_thread;
+    };
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ *  UdsStream.h
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+/** \file UdsStream.h This file defines UdsStream ERS stream.
+  * \brief ers header file
+  */
+
+#ifndef ERS_UDS_STREAM_H
+#define ERS_UDS_STREAM_H
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <ers/OutputStream.h>
+
+namespace ers
+{
+
+    /** This class sends issues to a collector process, which is running on the same node, via a Unix domain
+      * datagram socket. The collector receives them with the "uds" input stream and can write them to a
+      * single file for all the processes of the node. In order to employ this implementation in a stream
+      * configuration the name to be used is "uds" and the only parameter is the path of the collector socket, e.g.
+      *
+      *         export TDAQ_ERS_ERROR="lstderr,uds(/tmp/ers.sock)"
+      *
+      * Issues are encoded as binary frames (see ers/internal/IssueCodec.h), which are collected into datagrams
+      * of up to 64 KB. A datagram is sent as soon as it is full, otherwise it is sent by a background thread
+      * within 10 milliseconds. Fatal issues are sent immediately. The socket never blocks the reporting thread:
+      * if the collector is slow or not running the frames are dropped and counted.
+      *
+      * \brief Non-blocking on-node issue forwarding.
+      */
+
+    class UdsStream : public OutputStream
+    {
+      public:
+	static const size_t MaxDatagramSize = 65536;
+
+	explicit UdsStream( const std::string & path );
+
+        ~UdsStream();
+
+        void write( const Issue & issue ) override;
+
+	uint64_t dropped() const		/**< \return number of frames which could not be sent */
+	{ return m_dropped; }
+
+      private:
+	void flush();
+
+	void run();
+
+      private:
+	int			m_fd;
+	struct sockaddr_un	m_address;
+	std::atomic<uint64_t>	m_dropped;
+
+	std::mutex		m_mutex;
+	std::condition_variable	m_condition;
+	std::string		m_batch;	/**< \brief frames waiting to be sent */
+	size_t			m_frames;	/**< \brief number of frames in the current batch */
+	bool			m_terminated;
+	std::thread		m_flusher;
+    };
+}
+
+#endif
@@ -0,0 +1,89 @@
+"""Error reporting benchmark
+
+This module is part of the Error Reporting Service (ERS)
+package of the ATLAS TDAQ system.
+
+Measures how many issues per second can be created and reported from
+Python. Run it with "pytest -s" to see the measured rates.
+"""
+__author__ = "Serguei Kolos (Serguei.Kolos@cern.ch)"
+
+import os
+import time
+
+import pytest
+
+os.environ.setdefault( "TDAQ_ERS_LOG", "null" )
+os.environ.setdefault( "TDAQ_ERS_DEBUG", "null" )
+# fatal issues are thrown back to Python to measure the translation of C++ issues
+os.environ.setdefault( "TDAQ_ERS_FATAL", "throw" )
+
+ers = pytest.importorskip( "ers" )
+
+class BenchmarkIssue( ers.Issue ):
+    def __init__( self, fname, cause = None ):
+        ers.Issue.__init__( self, 'Can not open "%s" file' % fname, { 'filename' : fname }, cause )
+
+def rate( function, duration = 0.5 ):
+    "returns the number of function calls per second"
+    count = 0
+    start = time.perf_counter()
+    while True:
+        for i in range( 100 ):
+            function()
+        count += 100
+        elapsed = time.perf_counter() - start
+        if elapsed > duration:
+            return count / elapsed
+
+def report( name, value ):
+    print( '\n%s: %d issues per second' % ( name, value ) )
+
+def test_issue_creation():
+    value = rate( lambda: BenchmarkIssue( 'test.txt' ) )
+    report( 'issue creation', value )
+    assert value > 0
+
+def test_context():
+    issue = BenchmarkIssue( 'test.txt' )
+    assert issue.context.function_name.startswith( 'test_context' )
+    assert issue.context.file_name == __file__
+    assert issue.context.process_id == os.getpid()
+
+def test_log():
+    value = rate( lambda: ers.log( 'benchmark message' ) )
+    report( 'log', value )
+    assert value > 0
+
+def test_disabled_debug( monkeypatch ):
+    "a disabled debug message must not even be constructed"
+    created = []
+    message = ers.Message
+    class CountedMessage( message ):
+        def __init__( self, msg ):
+            created.append( msg )
+            message.__init__( self, msg )
+    monkeypatch.setattr( ers, 'Message', CountedMessage )
+
+    level = ers.liberspy.debug_level() + 1
+    ers.debug( level, 'disabled message' )
+    assert created == []
+    ers.debug( 0, 'enabled message' )
+    assert created == [ 'enabled message' ]
+    monkeypatch.undo()
+
+    # the rates depend on the machine load, so they are only printed
+    report( 'disabled debug', rate( lambda: ers.debug( level, 'benchmark message' ) ) )
+    report( 'enabled debug', rate( lambda: ers.debug( 0, 'benchmark message' ) ) )
+
+def test_translation():
+    issue = BenchmarkIssue( 'test.txt' )
+    def translate():
+        try:
+            ers.fatal( issue )
+        except ers.Issue as e:
+            return e
+    e = translate()
+    assert e.filename == 'test.txt'
+    assert e.context.line_number == issue.context.line_number
+    report( 'C++ issue translation', rate( translate ) )
@@ -30,39 +30,79 @@ class Severity( object ):
 SeverityNames = tuple ( [ [k for k, v in list(Severity.__dict__.items()) if v == s][0] \
                                         for s in Severity.values ] )
 
+class ProcessContext( object ):
+    "stores the context fields which are the same for all issues of the process"
+    def __init__( self ):
+        self.host_name = platform.node()
+        self.cwd = os.getcwd()
+        self.user_id = os.getuid()
+        self.user_name = getpass.getuser()
+        self.reset()
+
+    def reset( self ):
+        "the process id and application name must not be inherited by a child process"
+        self.process_id = os.getpid()
+        self.application_name = os.getenv( "TDAQ_APPLICATION_NAME", "Undefined" )
+
+process_context = ProcessContext()
+if hasattr( os, 'register_at_fork' ):
+    os.register_at_fork( after_in_child = process_context.reset )
+
 class Context( object ):
     "stores context of an ERS issue"    
+    # the attributes are kept in slots, which are read directly by liberspy
+    __slots__ = ( 'package_name', 'file_name', 'line_number', 'function_name', 'host_name', 'process_id',
+                  'thread_id', 'cwd', 'user_id', 'user_name', 'application_name' )
     __file = re.sub( r'\.pyc$', '.py', __file__ )
+    __verbosity = int( os.getenv( "TDAQ_ERS_VERBOSITY_LEVEL", "0" ) )
+
+    @staticmethod
+    def __self( frame ):
+        "returns the object which method is executed by the frame or None"
+        code = frame.f_code
+        if code.co_argcount and code.co_varnames[0] == 'self':
+            return frame.f_locals.get( 'self' )
+        return None
 
     def __init__( self, issue ):
-        self.stack = [f[0] for f in inspect.stack() \
-                        if  f[1] != self.__file \
-                        and (      'self' not in f[0].f_locals\
-                                or not isinstance(f[0].f_locals['self'], Issue))]
-                                
-        self.package_name = issue.__class__.__module__
-        class_name    = lambda : 'self' in self.stack[0].f_locals \
-                                 and self.stack[0].f_locals['self'].__class__.__name__ + '.'\
-                                 or ''
+        # skip the frames of this module and of the constructors of the Issue subclasses
+        frame = sys._getframe( 1 )
+        while frame.f_back is not None \
+                and ( frame.f_code.co_filename == self.__file \
+                      or isinstance( self.__self( frame ), Issue ) ):
+            frame = frame.f_back
 
-        self.function_name = class_name() + self.stack[0].f_code.co_name;
-        try:
-            self.function_name += inspect.formatargvalues( *inspect.getargvalues(self.stack[0]) )
-        except Exception as exx:
+        self.package_name = issue.__class__.__module__
+        obj = self.__self( frame )
+        self.function_name = ( obj is not None and obj.__class__.__name__ + '.' or '' ) + frame.f_code.co_name
+        # function arguments are only shown for non-zero verbosity
+        if self.__verbosity > 0:
+            try:
+                self.function_name += inspect.formatargvalues( *inspect.getargvalues( frame ) )
+            except Exception as exx:
+                self.function_name += '(...)'
+        else:
             self.function_name += '(...)'
-                
-        self.file_name = self.stack[0].f_code.co_filename
-        self.line_number = self.stack[0].f_lineno
-        self.host_name = platform.node()
-        self.cwd = os.getcwd()
-        self.process_id = os.getpid()
+
+        self.file_name = frame.f_code.co_filename
+        self.line_number = frame.f_lineno
         self.thread_id = _thread.get_ident()
-        self.user_id = os.getuid()
-        self.user_name = getpass.getuser()
-        self.application_name = os.getenv( "TDAQ_APPLICATION_NAME", "Undefined" )
+
+        p = process_context
+        self.host_name = p.host_name
+        self.cwd = p.cwd
+        self.process_id = p.process_id
+        self.user_id = p.user_id
+        self.user_name = p.user_name
+        self.application_name = p.application_name
                 
 class Issue( Exception ):
-    "base class for ERS exceptions"    
+    """base class for ERS exceptions
+
+    The issues received from C++ keep the original C++ issue in the __native attribute,
+    their context and parameters are converted to Python only when they are used."""
+    # the attributes are kept in slots, which are read directly by liberspy
+    __slots__ = ( 'time', 'severity', 'message', 'cause', 'qualifiers', '__context', '__parameters', '__native' )
     __verbosity = int( os.getenv( "TDAQ_ERS_VERBOSITY_LEVEL", "0" ) )
     
     def __init__( self, message, kwargs, cause ):
@@ -71,18 +111,37 @@ class Issue( Exception ):
         self.severity = Severity.ERROR
         self.message = message
         self.cause = cause
+        self.__native = None
         self.__context = Context( self )
         self.qualifiers = [ self.__context.package_name ]
-        self.__parameters = dict([ (str(k), str(v)) for (k,v) in list(kwargs.items()) ])
+        self.__parameters = { str(k) : str(v) for (k,v) in kwargs.items() }
         self.__dict__.update( kwargs )
         
     @property
     def context( self ):
+        if self.__context is None:
+            self.__context = liberspy.context( self.__native )
         return self.__context
             
     @property
     def parameters( self ):
+        if self.__parameters is None:
+            self.__parameters = liberspy.parameters( self.__native )
+            self.__dict__.update( self.__parameters )
         return self.__parameters
+
+    def __getattr__( self, name ):
+        "gives access to the parameters of the issues received from C++ as to attributes"
+        try:
+            native = object.__getattribute__( self, '_Issue__native' )
+        except AttributeError:
+            native = None
+        if native is None or name.startswith( '__' ):
+            raise AttributeError( name )
+        try:
+            return self.parameters[name]
+        except KeyError:
+            raise AttributeError( name )
                     
     def isInstanceOf( self, cname ):
             return self.__class__.__name__ == cname and True or False
@@ -94,9 +153,9 @@ class Issue( Exception ):
         s = '%s %s [%s at %s:%d] %s' % ( 
                         SeverityNames[self.severity],
                         time.strftime( '%Y-%b-%d %H:%M:%S', time.localtime( self.time ) ),
-                        pretty_function( self.__context.function_name, self.__verbosity ),
-                        self.__context.file_name,
-                        self.__context.line_number,
+                        pretty_function( self.context.function_name, self.__verbosity ),
+                        self.context.file_name,
+                        self.context.line_number,
                         self.message )
         if self.cause != None:
             s += '\n\twas caused by: %s' % repr(self.cause)
@@ -118,10 +177,12 @@ if sys.platform == 'linux2':
     sys.setdlopenflags( flags )
 else:
     import liberspy
-liberspy.init( Issue )        
+liberspy.init( Issue, Context )        
                   
 def debug( lvl, msg ):
     "sends msg to the debug stream"
+    if lvl > liberspy.debug_level():
+        return
     liberspy.debug( lvl, isinstance( msg, Issue ) and msg or Message( msg ) )
 
 def log( msg ):
@@ -160,6 +221,8 @@ class LoggingHandler( logging.Handler ) :
         logging.Handler.__init__(self)
         
     def emit(self, record):
+        if record.levelno == logging.DEBUG and liberspy.debug_level() < 0:
+            return
         if isinstance( record.msg, Issue ):
             self.severity_mapper[record.levelname]( record.msg )
         else:
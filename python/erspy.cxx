@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 
 #include <boost/noncopyable.hpp>
@@ -5,7 +6,11 @@
 #include <boost/python.hpp>
 #include <boost/python/exception_translator.hpp>
 
+#include <structmember.h>
+
+#include <iterator>
 #include <mutex>
+#include <stdexcept>
 #include <unordered_map>
 
 #include <ers/ers.h>
@@ -23,7 +28,7 @@ namespace
 	{ ; }
 
 	~Py_RH()
-	{ Py_DECREF(m_object); }
+	{ Py_XDECREF(m_object); }
 
 	operator PyObject *() const { return m_object; }
 
@@ -31,9 +36,134 @@ namespace
 	PyObject * m_object;
     };
 
+    /** Releases the GIL while the issue is passed through the ERS streams, so that
+        other Python threads can run while the streams are writing. */
+    struct GILRelease : boost::noncopyable {
+	GILRelease() : m_state(PyEval_SaveThread())
+	{ ; }
+
+	~GILRelease()
+	{ PyEval_RestoreThread(m_state); }
+
+    private:
+	PyThreadState * m_state;
+    };
+
+    /** Gives fast access to the attributes of the Python classes, which declare them in __slots__.
+        The attribute names are interned once and the slots are read directly using the offsets
+        of their member descriptors. Objects of other types are accessed as usual. */
+    template <size_t N>
+    struct Layout {
+	Layout()
+	{ std::fill(m_offsets, m_offsets + N, -1); }
+
+	void init(PyObject * type, const char * const (&fields)[N])
+	{
+	    m_type = (PyTypeObject*)type;
+	    for (size_t i = 0; i < N; ++i) {
+		m_names[i] = PyUnicode_InternFromString(fields[i]);
+		m_offsets[i] = -1;
+		Py_RH d(PyObject_GetAttr(type, m_names[i]));
+		if (d && Py_TYPE((PyObject*)d) == &PyMemberDescr_Type) {
+		    PyMemberDef * m = ((PyMemberDescrObject*)(PyObject*)d)->d_member;
+		    if (m->type == T_OBJECT_EX)
+			m_offsets[i] = m->offset;
+		}
+	    }
+	    PyErr_Clear();
+	}
+
+	bool is_slotted(PyObject * o, size_t field) const
+	{ return m_offsets[field] >= 0 && PyObject_TypeCheck(o, m_type); }
+
+	/** Returns new reference to the attribute value or null if the attribute is not set. */
+	PyObject * get(PyObject * o, size_t field) const
+	{
+	    if (is_slotted(o, field)) {
+		PyObject * v = *(PyObject**)((char*)o + m_offsets[field]);
+		Py_XINCREF(v);
+		return v;
+	    }
+	    PyObject * v = PyObject_GetAttr(o, m_names[field]);
+	    if (!v)
+		PyErr_Clear();
+	    return v;
+	}
+
+	/** Sets the attribute, steals the value reference. */
+	void set(PyObject * o, size_t field, PyObject * value) const
+	{
+	    if (is_slotted(o, field)) {
+		Py_XSETREF(*(PyObject**)((char*)o + m_offsets[field]), value);
+		return;
+	    }
+	    PyObject_SetAttr(o, m_names[field], value);
+	    Py_DECREF(value);
+	}
+
+	PyObject * create() const
+	{
+	    Py_RH args(PyTuple_New(0));
+	    return m_type->tp_new(m_type, args, 0);
+	}
+
+	PyTypeObject *	m_type = 0;
+	PyObject *	m_names[N] = {};
+	Py_ssize_t	m_offsets[N];
+    };
+
+    enum IssueField { Message, Severity, Time, Cause, Qualifiers, IssueContext, IssueParameters, Native };
+    const char * const issue_fields[] = { "message", "severity", "time", "cause", "qualifiers",
+					  "_Issue__context", "_Issue__parameters", "_Issue__native" };
+
+    enum ContextField { PackageName, FileName, LineNumber, FunctionName, HostName, ProcessId,
+			ThreadId, Cwd, UserId, UserName, ApplicationName };
+    const char * const context_fields[] = { "package_name", "file_name", "line_number", "function_name",
+					    "host_name", "process_id", "thread_id", "cwd", "user_id",
+					    "user_name", "application_name" };
+
+    Layout<std::size(issue_fields)>	issue_layout;
+    Layout<std::size(context_fields)>	context_layout;
+
+    const char * const NativeIssue = "ers.Issue";
+
+    std::string
+    to_string( PyObject * o )
+    {
+	if (o && PyUnicode_Check(o)) {
+	    Py_ssize_t size;
+	    const char * s = PyUnicode_AsUTF8AndSize(o, &size);
+	    if (s)
+		return std::string(s, size);
+	}
+	else if (o) {
+	    Py_RH str(PyObject_Str(o));
+	    if (str)
+		return to_string(str);
+	}
+	PyErr_Clear();
+	return std::string();
+    }
+
+    long
+    to_long( PyObject * o )
+    {
+	long v = o ? PyLong_AsLong(o) : 0;
+	if (v == -1)
+	    PyErr_Clear();
+	return v;
+    }
+
+    void
+    delete_native( PyObject * capsule )
+    {
+	delete static_cast<ers::Issue*>(PyCapsule_GetPointer(capsule, NativeIssue));
+    }
 
     PyObject * base_ex_type;
     
+    /** Creates a Python proxy for the C++ issue. The proxy keeps a copy of the C++ issue and
+        its context and parameters are converted to Python objects only if they are used. */
     PyObject * 
     to_python( PyObject *& custom_ex_type, ers::Issue const & ex )
     {
@@ -44,60 +174,101 @@ namespace
         
         std::string str = ex.get_class_name();
         boost::replace_all( str, cpp_separator, py_separator );
+	// Python exception names must be qualified with a module name
+	if ( str.find( py_separator ) == std::string::npos )
+	    str.insert( 0, "ers." );
         
         {
             std::unique_lock<std::mutex> lock(types_mutex);
             std::unordered_map<std::string, PyObject *>::iterator it = ex_types.find(str);
 	    if (it == ex_types.end()) {
 		custom_ex_type = PyErr_NewException( (char*)str.c_str(), base_ex_type, 0 );
+		if ( !custom_ex_type ) {
+		    PyErr_Clear();
+		    custom_ex_type = base_ex_type;
+		}
 		ex_types[str] = custom_ex_type;
 	    } else {
 		custom_ex_type = it->second;
 	    }
         }
 
-	Py_RH args(PyTuple_New( 3 ));
-	PyTuple_SetItem( args, 0, PyUnicode_FromString(ex.what()) );
-	PyTuple_SetItem( args, 1, PyDict_New() );
+	Py_RH args(PyTuple_New( 0 ));
+	PyObject * e = ((PyTypeObject*)custom_ex_type)->tp_new( (PyTypeObject*)custom_ex_type, args, 0 );
+
+	issue_layout.set( e, Message, PyUnicode_FromString( ex.what() ) );
+	issue_layout.set( e, Severity, PyLong_FromLong( (ers::severity)ex.severity() ) );
+	issue_layout.set( e, Time, PyFloat_FromDouble( std::chrono::duration<double>(
+		ex.ptime().time_since_epoch() ).count() ) );
+
     	if ( !ex.cause() )
         {
     	    Py_INCREF( Py_None );
-    	    PyTuple_SetItem( args, 2, Py_None );
+	    issue_layout.set( e, Cause, Py_None );
         }
 	else
 	{
 	    PyObject * t = 0;
-            PyTuple_SetItem( args, 2, to_python( t, *ex.cause() ) );
+	    issue_layout.set( e, Cause, to_python( t, *ex.cause() ) );
         }
 
-    	PyObject * e = PyObject_CallObject( custom_ex_type, args );
-
-        PyObject_SetAttrString( e, "severity", PyLong_FromLong((ers::severity)ex.severity()) );
-        
         const std::vector<std::string> & q = ex.qualifiers();
-        Py_RH qualifiers(PyList_New(q.size()));
+        PyObject * qualifiers = PyList_New(q.size());
 	for ( size_t i = 0; i < q.size(); ++i )
 	{
-            PyList_SetItem( qualifiers, i, PyUnicode_FromString( q[i].c_str() ) );
+            PyList_SET_ITEM( qualifiers, i, PyUnicode_FromStringAndSize( q[i].data(), q[i].size() ) );
 	}
-        PyObject_SetAttrString( e, "qualifiers", qualifiers );
+	issue_layout.set( e, Qualifiers, qualifiers );
+
+	Py_INCREF( Py_None );
+	issue_layout.set( e, IssueContext, Py_None );
+	Py_INCREF( Py_None );
+	issue_layout.set( e, IssueParameters, Py_None );
+	issue_layout.set( e, Native, PyCapsule_New( ex.clone(), NativeIssue, &delete_native ) );
         
-        const ers::string_map & p = ex.parameters();
-        Py_RH parameters(PyObject_GetAttrString( e, "__dict__" ));
+        return e;
+    }
+
+    /** Converts the context of the C++ issue kept by a Python proxy. */
+    PyObject *
+    context( PyObject * native )
+    {
+	const ers::Issue * ex = static_cast<ers::Issue*>(PyCapsule_GetPointer(native, NativeIssue));
+	if ( !ex )
+	    boost::python::throw_error_already_set();
+
+	const ers::Context & c = ex->context();
+	PyObject * o = context_layout.create();
+	context_layout.set( o, PackageName, PyUnicode_FromString( c.package_name() ) );
+	context_layout.set( o, FileName, PyUnicode_FromString( c.file_name() ) );
+	context_layout.set( o, LineNumber, PyLong_FromLong( c.line_number() ) );
+	context_layout.set( o, FunctionName, PyUnicode_FromString( c.function_name() ) );
+	context_layout.set( o, HostName, PyUnicode_FromString( c.host_name() ) );
+	context_layout.set( o, ProcessId, PyLong_FromLong( c.process_id() ) );
+	context_layout.set( o, ThreadId, PyLong_FromLong( c.thread_id() ) );
+	context_layout.set( o, Cwd, PyUnicode_FromString( c.cwd() ) );
+	context_layout.set( o, UserId, PyLong_FromLong( c.user_id() ) );
+	context_layout.set( o, UserName, PyUnicode_FromString( c.user_name() ) );
+	context_layout.set( o, ApplicationName, PyUnicode_FromString( c.application_name() ) );
+	return o;
+    }
+
+    /** Converts the parameters of the C++ issue kept by a Python proxy. */
+    PyObject *
+    parameters( PyObject * native )
+    {
+	const ers::Issue * ex = static_cast<ers::Issue*>(PyCapsule_GetPointer(native, NativeIssue));
+	if ( !ex )
+	    boost::python::throw_error_already_set();
+
+	PyObject * d = PyDict_New();
+        const ers::string_map & p = ex->parameters();
 	for ( ers::string_map::const_iterator it = p.begin(); it != p.end(); ++it )
         {
-            PyDict_SetItem( 	parameters, 
-            			PyUnicode_FromString( it -> first.c_str() ), 
-                                PyUnicode_FromString( it -> second.c_str() ) );
+	    Py_RH value( PyUnicode_FromStringAndSize( it->second.data(), it->second.size() ) );
+	    PyDict_SetItemString( d, it->first.c_str(), value );
         }
-
-	Py_RH c(PyObject_GetAttrString( e, "_Issue__context" ));
-        PyObject_SetAttrString( c, "package_name", PyUnicode_FromString(ex.context().package_name()) );
-        PyObject_SetAttrString( c, "file_name", PyUnicode_FromString(ex.context().file_name()) );
-        PyObject_SetAttrString( c, "function_name", PyUnicode_FromString(ex.context().function_name()) );
-        PyObject_SetAttrString( c, "line_number", PyLong_FromLong(ex.context().line_number()) );
-        
-        return e;
+	return d;
     }
     
     void 
@@ -110,70 +281,83 @@ namespace
     }
 
     void 
-    init( PyObject * o )
+    init( PyObject * issue_type, PyObject * context_type )
     {
-	base_ex_type = o;
+	base_ex_type = issue_type;
+	issue_layout.init( issue_type, issue_fields );
+	context_layout.init( context_type, context_fields );
     }
     
     ers::Issue * 
     issue( PyObject * o )
     {
-        if (!o)
+        if (!o || o == Py_None)
             return 0;
 
-	std::string id	= PyUnicode_AsUTF8(
-	    Py_RH( PyObject_GetAttrString( PyObject_Type( o ), "__name__" ) ) );
-	
-	std::string msg = PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( o, "message" ) ) );
-        
-	Py_RH c(PyObject_GetAttrString( o, "context" ));
+	// an issue received from C++ is reported as it is
+	Py_RH native(issue_layout.get( o, Native ));
+	if (native && PyCapsule_CheckExact((PyObject*)native)) {
+	    const ers::Issue * ex = static_cast<ers::Issue*>(PyCapsule_GetPointer(native, NativeIssue));
+	    if (ex)
+		return ex->clone();
+	    PyErr_Clear();
+	}
+
+	Py_RH c(issue_layout.get( o, IssueContext ));
+	if (!c || (PyObject*)c == Py_None)
+	    throw std::invalid_argument("the issue has no context, ers.Issue.__init__ was not called");
+
 	ers::RemoteContext context(
-		    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "package_name" ) ) ),
-		    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "file_name" ) ) ),
-		    PyLong_AsLong( Py_RH( PyObject_GetAttrString( c, "line_number" ) ) ),
-		    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "function_name" ) ) ),
+		    to_string( Py_RH( context_layout.get( c, PackageName ) ) ),
+		    to_string( Py_RH( context_layout.get( c, FileName ) ) ),
+		    to_long( Py_RH( context_layout.get( c, LineNumber ) ) ),
+		    to_string( Py_RH( context_layout.get( c, FunctionName ) ) ),
 		    ers::RemoteProcessContext(
-			    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "host_name" ) ) ),
-			    PyLong_AsLong( Py_RH( PyObject_GetAttrString( c, "process_id" ) ) ),
-			    PyLong_AsLong( Py_RH( PyObject_GetAttrString( c, "thread_id" ) ) ),
-			    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "cwd" ) ) ),
-			    PyLong_AsLong( Py_RH( PyObject_GetAttrString( c, "user_id" ) ) ),
-			    PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "user_name" ) ) ),
-                            PyUnicode_AsUTF8( Py_RH( PyObject_GetAttrString( c, "application_name" ) ) ) ) );
+			    to_string( Py_RH( context_layout.get( c, HostName ) ) ),
+			    to_long( Py_RH( context_layout.get( c, ProcessId ) ) ),
+			    to_long( Py_RH( context_layout.get( c, ThreadId ) ) ),
+			    to_string( Py_RH( context_layout.get( c, Cwd ) ) ),
+			    to_long( Py_RH( context_layout.get( c, UserId ) ) ),
+			    to_string( Py_RH( context_layout.get( c, UserName ) ) ),
+                            to_string( Py_RH( context_layout.get( c, ApplicationName ) ) ) ) );
 
         std::vector<std::string> qualifiers;
-        Py_RH q(PyObject_GetAttrString( o, "qualifiers" ));
-        int size = PyList_Size( q );
-        for (int i = 0; i < size; ++i ) {
-            qualifiers.push_back(PyUnicode_AsUTF8(PyList_GetItem(q, i)));
-        }
+        Py_RH q(issue_layout.get( o, Qualifiers ));
+	if (q && PyList_Check((PyObject*)q)) {
+	    Py_ssize_t size = PyList_GET_SIZE( (PyObject*)q );
+	    qualifiers.reserve( size );
+	    for (Py_ssize_t i = 0; i < size; ++i ) {
+		qualifiers.push_back(to_string(PyList_GET_ITEM((PyObject*)q, i)));
+	    }
+	}
 
 	std::map<std::string, std::string> parameters;
-	Py_RH items(PyDict_Items(Py_RH(PyObject_GetAttrString(o, "parameters"))));
-        size = PyList_Size( items );
-        for (int i = 0; i < size; ++i ) {
-            PyObject * item = PyList_GetItem(items, i);
-            parameters.insert( std::make_pair(
-        	PyUnicode_AsUTF8(PyTuple_GetItem(item, 0)),
-        	PyUnicode_AsUTF8(PyTuple_GetItem(item, 1))
-        	));
-        }
+	Py_RH p(issue_layout.get( o, IssueParameters ));
+	if (p && PyDict_Check((PyObject*)p)) {
+	    Py_ssize_t pos = 0;
+	    PyObject * key, * value;
+	    while (PyDict_Next(p, &pos, &key, &value)) {
+		parameters.emplace( to_string(key), to_string(value) );
+	    }
+	}
 
-	double t = PyFloat_AsDouble( Py_RH( PyObject_GetAttrString(o, "time")));
+	Py_RH pt(issue_layout.get( o, Time ));
+	double t = pt ? PyFloat_AsDouble( pt ) : 0;
 	std::chrono::system_clock::time_point
 	    time(std::chrono::nanoseconds(static_cast<int64_t>(t*1000000000.)));
 
-	Py_RH cause(PyObject_GetAttrString(o, "cause"));
+	Py_RH cause(issue_layout.get( o, Cause ));
 
-	return new ers::AnyIssue(id, ers::Error, context, time, msg,
-				    qualifiers, parameters,
-				    cause != Py_None ? issue( cause ) : 0 );
+	return new ers::AnyIssue(Py_TYPE(o)->tp_name, ers::Error, context, time,
+				    to_string( Py_RH( issue_layout.get( o, Message ) ) ),
+				    qualifiers, parameters, issue( cause ) );
     }
     
     void
     debug( int level, PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+        GILRelease release;
         ers::debug( *a, level );
     }
     
@@ -181,6 +365,7 @@ namespace
     log( PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+    	GILRelease release;
     	ers::log( *a );
     }
     
@@ -188,6 +373,7 @@ namespace
     info( PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+    	GILRelease release;
     	ers::info( *a );
     }
     
@@ -195,6 +381,7 @@ namespace
     warning( PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+    	GILRelease release;
     	ers::warning( *a );
     }
     
@@ -202,6 +389,7 @@ namespace
     error( PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+    	GILRelease release;
     	ers::error( *a );
     }
     
@@ -209,6 +397,7 @@ namespace
     fatal( PyObject * o )
     {
     	std::unique_ptr<ers::Issue> a( issue( o ) );
+    	GILRelease release;
     	ers::fatal( *a );
     }
 
@@ -216,6 +405,9 @@ namespace
     {
 	boost::python::register_exception_translator<ers::Issue>(&translate_exception);
 	boost::python::def("init", &init);
+	boost::python::def("debug_level", &ers::debug_level);
+	boost::python::def("context", &context);
+	boost::python::def("parameters", &parameters);
 	boost::python::def("debug", &debug);
 	boost::python::def("log", &log);
 	boost::python::def("info", &info);
@@ -0,0 +1,321 @@
+/*
+ *  Clock.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <time.h>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#define ERS_HAS_TSC
+#endif
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ers/Clock.h>
+#include <ers/ers.h>
+#include <ers/internal/Util.h>
+#include <ers/internal/macro.h>
+
+ERS_DECLARE_ISSUE(	ers,
+			BadClockSource,
+			"string \"" << source << "\" does not contain valid clock source",
+                        ((std::string)source) )
+
+namespace
+{
+    const char * ClockNames[] =
+    {
+	"realtime",
+	"coarse",
+	"tsc"
+    };
+
+    using std::chrono::system_clock;
+    using std::chrono::steady_clock;
+
+    thread_local ers::severity t_severity = ers::Error;
+
+    /** \return true if the CPU time stamp counter runs at a constant rate, which is required by the TSC clock */
+    bool has_invariant_tsc()
+    {
+#ifdef ERS_HAS_TSC
+	std::ifstream in( "/proc/cpuinfo" );
+	std::string line;
+	while ( std::getline( in, line ) )
+	{
+	    if ( line.compare( 0, 5, "flags" ) == 0 )
+	    {
+		return line.find( " constant_tsc" ) != std::string::npos
+		    && line.find( " nonstop_tsc" ) != std::string::npos;
+	    }
+	}
+#endif
+	return false;
+    }
+
+    /** Clock sources per severity. The table is filled when the library is loaded, issues can not be
+      * created at this point, so the configuration errors are reported later by ers::Configuration.
+      */
+    struct Sources
+    {
+	Sources()
+	{
+	    const char * env = ::getenv( "TDAQ_ERS_CLOCK" );
+	    std::vector<std::string> tokens;
+	    ers::tokenize( env ? env : "", ",", tokens );
+	    for ( size_t i = 0; i < tokens.size(); ++i )
+	    {
+		if ( tokens[i].empty() )
+		    continue;
+
+		std::string::size_type pos = tokens[i].find( '=' );
+		int first = ers::Debug, last = ers::Fatal;
+		if ( pos != std::string::npos )
+		{
+		    first = find( tokens[i].substr( 0, pos ), [](int s){ return ers::to_string( (ers::severity)s ); },
+				ers::Debug, ers::Fatal );
+		    last = first;
+		}
+		int source = find( tokens[i].substr( pos == std::string::npos ? 0 : pos + 1 ),
+				[](int s){ return ers::to_string( (ers::clock_source)s ); },
+				ers::RealtimeClock, ers::TscClock );
+		if ( first < 0 || source < 0 )
+		{
+		    m_error += ( m_error.empty() ? "\"" : ", \"" ) + tokens[i] + "\"";
+		    continue;
+		}
+		for ( int s = first; s <= last; ++s )
+		    m_sources[s] = (ers::clock_source)source;
+	    }
+
+	    for ( int s = ers::Debug; s <= ers::Fatal; ++s )
+	    {
+		if ( m_sources[s] == ers::TscClock && !has_invariant_tsc() )
+		{
+		    m_warning = "CPU does not have invariant TSC, the realtime clock will be used instead";
+		    break;
+		}
+	    }
+	}
+
+	template <class F>
+	static int find( const std::string & name, F to_string, int first, int last )
+	{
+	    for ( int i = first; i <= last; ++i )
+		if ( name == to_string( i ) )
+		    return i;
+	    return -1;
+	}
+
+	std::atomic<ers::clock_source>	m_sources[ers::Fatal + 1] = {};
+	std::string			m_error;
+	std::string			m_warning;
+    } g_sources;
+
+    int64_t read( clockid_t id )
+    {
+	timespec ts;
+	clock_gettime( id, &ts );
+	return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+    }
+
+    ers::clock::Timestamp make( int64_t realtime, int64_t monotonic )
+    {
+	return ers::clock::Timestamp{
+	    system_clock::time_point( std::chrono::duration_cast<system_clock::duration>(
+		    std::chrono::nanoseconds( realtime ) ) ),
+	    steady_clock::time_point( std::chrono::duration_cast<steady_clock::duration>(
+		    std::chrono::nanoseconds( monotonic ) ) ) };
+    }
+
+#ifdef ERS_HAS_TSC
+    /** Converts the CPU time stamp counter to nanoseconds. The counter frequency is measured against
+      * CLOCK_MONOTONIC, the measurement gets more precise as the process runs. The realtime anchor is
+      * updated every second, so the TSC based time follows the adjustments of the system time.
+      * The anchor is published with a sequence lock, so the readers never wait.
+      */
+    class TscCounter
+    {
+	static constexpr int64_t AnchorPeriod = 1000000000;
+
+      public:
+	static TscCounter * instance()
+	{
+	    static TscCounter * clock = create();
+	    return clock;
+	}
+
+	ers::clock::Timestamp now()
+	{
+	    uint64_t tsc = __rdtsc();
+	    uint64_t seq;
+	    int64_t delta, realtime, monotonic;
+	    do
+	    {
+		seq = m_sequence.load( std::memory_order_acquire );
+		delta = ( int64_t )( ( int64_t )( tsc - m_tsc.load( std::memory_order_relaxed ) )
+				* m_ns_per_tick.load( std::memory_order_relaxed ) );
+		realtime = m_realtime.load( std::memory_order_relaxed ) + delta;
+		monotonic = m_monotonic.load( std::memory_order_relaxed ) + delta;
+		std::atomic_thread_fence( std::memory_order_acquire );
+	    }
+	    while ( seq & 1 || seq != m_sequence.load( std::memory_order_relaxed ) );
+
+	    if ( delta > AnchorPeriod )
+	    {
+		anchor();
+	    }
+	    return make( realtime, monotonic );
+	}
+
+      private:
+	TscCounter()
+	  : m_sequence( 0 )
+	{
+	    m_calibration_tsc = __rdtsc();
+	    m_calibration_monotonic = read( CLOCK_MONOTONIC_RAW );
+	    timespec ts = { 0, 10000000 };
+	    nanosleep( &ts, 0 );
+	    anchor();
+	}
+
+	static TscCounter * create()
+	{
+	    // issues can not be created here since this function initializes the static instance,
+	    // the fallback is reported by ers::Configuration if the TSC clock is set by TDAQ_ERS_CLOCK
+	    return has_invariant_tsc() ? new TscCounter() : 0;
+	}
+
+	void anchor()
+	{
+	    std::unique_lock lock( m_mutex, std::try_to_lock );
+	    if ( !lock )
+	    {
+		return;
+	    }
+
+	    uint64_t tsc = __rdtsc();
+	    int64_t raw = read( CLOCK_MONOTONIC_RAW );
+	    int64_t realtime = read( CLOCK_REALTIME );
+	    int64_t monotonic = read( CLOCK_MONOTONIC );
+
+	    uint64_t seq = m_sequence.load( std::memory_order_relaxed );
+	    m_sequence.store( seq + 1, std::memory_order_relaxed );
+	    std::atomic_thread_fence( std::memory_order_release );
+	    m_ns_per_tick.store( double( raw - m_calibration_monotonic ) / double( tsc - m_calibration_tsc ),
+		    std::memory_order_relaxed );
+	    m_tsc.store( tsc, std::memory_order_relaxed );
+	    m_realtime.store( realtime, std::memory_order_relaxed );
+	    m_monotonic.store( monotonic, std::memory_order_relaxed );
+	    m_sequence.store( seq + 2, std::memory_order_release );
+	}
+
+	std::mutex		m_mutex;
+	uint64_t		m_calibration_tsc;
+	int64_t			m_calibration_monotonic;
+	std::atomic<uint64_t>	m_sequence;
+	std::atomic<uint64_t>	m_tsc;
+	std::atomic<double>	m_ns_per_tick;
+	std::atomic<int64_t>	m_realtime;
+	std::atomic<int64_t>	m_monotonic;
+    };
+#endif
+}
+
+/** Returns the current time read from the given clock source.
+  */
+ers::clock::Timestamp
+ers::clock::now( ers::clock_source source )
+{
+    switch ( source )
+    {
+	case ers::CoarseClock:
+	    return make( read( CLOCK_REALTIME_COARSE ), read( CLOCK_MONOTONIC_COARSE ) );
+#ifdef ERS_HAS_TSC
+	case ers::TscClock:
+	    if ( TscCounter * tsc = TscCounter::instance() )
+	    {
+		return tsc->now();
+	    }
+	    break;
+#endif
+	default:
+	    break;
+    }
+    return Timestamp{ system_clock::now(), steady_clock::now() };
+}
+
+ers::clock_source
+ers::clock::source( ers::severity severity )
+{
+    return g_sources.m_sources[severity].load( std::memory_order_relaxed );
+}
+
+void
+ers::clock::source( ers::severity severity, ers::clock_source source )
+{
+    g_sources.m_sources[severity].store( source, std::memory_order_relaxed );
+}
+
+const std::string &
+ers::clock::configuration_error()
+{
+    return g_sources.m_error;
+}
+
+const std::string &
+ers::clock::configuration_warning()
+{
+    return g_sources.m_warning;
+}
+
+ers::severity
+ers::clock::current_severity()
+{
+    return t_severity;
+}
+
+ers::clock::Scope::Scope( ers::severity severity )
+  : m_previous( t_severity )
+{
+    t_severity = severity;
+}
+
+ers::clock::Scope::~Scope()
+{
+    t_severity = m_previous;
+}
+
+/**
+ * \brief Transforms a clock source into the corresponding string
+ */
+std::string
+ers::to_string( ers::clock_source source )
+{
+    return ClockNames[source];
+}
+
+/** Parses a string and extracts a clock source
+ * \param s the string to parse
+ * \return a clock source value
+ */
+ers::clock_source
+ers::parse( const std::string & string, ers::clock_source & s )
+{
+    for( short cs = ers::RealtimeClock; cs <= ers::TscClock; ++cs )
+    {
+	if ( string == ClockNames[cs] )
+	{
+            return ( s = (ers::clock_source)cs );
+	}
+    }
+    throw ers::BadClockSource( ERS_HERE, string );
+}
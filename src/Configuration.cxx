@@ -13,6 +13,7 @@
 #include <ers/ers.h>
 #include <ers/internal/SingletonCreator.h>
 #include <ers/internal/Util.h>
+#include <ers/internal/macro.h>
 
 /** This method returns the singleton instance. 
   * It should be used for every operation on the factory. 
@@ -33,10 +34,22 @@ ers::Configuration::instance()
   */
 ers::Configuration::Configuration()
   : m_debug_level( 0 ),
-    m_verbosity_level( 0 )
+    m_verbosity_level( 0 ),
+    m_raw_stack( false )
 {
     m_debug_level = read_from_environment( "TDAQ_ERS_DEBUG_LEVEL", m_debug_level );
     m_verbosity_level = read_from_environment( "TDAQ_ERS_VERBOSITY_LEVEL", m_verbosity_level );
+    m_raw_stack = read_from_environment( "TDAQ_ERS_RAW_STACK", 0 );
+
+    if ( !ers::clock::configuration_error().empty() )
+    {
+	ERS_INTERNAL_ERROR( "Wrong value of the TDAQ_ERS_CLOCK environment variable: " << ers::clock::configuration_error() )
+    }
+
+    if ( !ers::clock::configuration_warning().empty() )
+    {
+	ERS_INTERNAL_WARNING( ers::clock::configuration_warning() )
+    }
 }
 
 void 
@@ -48,6 +61,11 @@ ers::Configuration::verbosity_level( int verbosity_level )
 std::ostream & 
 ers::operator<<( std::ostream & out, const ers::Configuration & conf )
 {
-    out << "debug level = " << conf.m_debug_level << " verbosity level = " << conf.m_verbosity_level;
+    out << "debug level = " << conf.m_debug_level << " verbosity level = " << conf.m_verbosity_level
+	<< " raw stack = " << conf.m_raw_stack << " clocks =";
+    for ( short ss = ers::Debug; ss <= ers::Fatal; ++ss )
+    {
+	out << " " << ers::to_string( (ers::severity)ss ) << "=" << ers::to_string( conf.clock( (ers::severity)ss ) );
+    }
     return out;
 }
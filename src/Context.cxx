@@ -7,7 +7,6 @@
  *
  */
 #include <string.h>
-#include <cxxabi.h>
 #include <sys/types.h>
 #include <pwd.h>
 #include <unistd.h>
@@ -15,50 +14,19 @@
 #include <iostream>
 #include <sstream>
 
-#ifndef __rtems__
-#include <execinfo.h>
-#else
-char** backtrace_symbols (void ** , int size) {
-    return 0;
-}
-#endif
-
 #include <ers/Context.h>
 #include <ers/Configuration.h>
+#include <ers/internal/Format.h>
+#include <ers/internal/Symbolizer.h>
 
 namespace
 {
-    std::string
-    demangle( char * mangled )
-    {
-        int status;
-	char * function_begin = ::strchr( mangled, '(' );
-        if ( function_begin ) {
-            char * function_end = ::strchr( ++function_begin, '+' );
-            if ( function_end && function_end != function_begin)
-            {
-                std::string fname(function_begin, function_end - function_begin);
-                char * name = abi::__cxa_demangle( fname.c_str(), 0, 0, &status );
-
-                if (!name) {
-                    return std::string( mangled );
-                }
-
-                std::ostringstream out;
-                out << std::string(mangled, function_begin - mangled) << name << function_end;
-                free( name );
-                return out.str();
-            }
-        }
-	return std::string( mangled );
-    }
-
     void
-    print_function( std::ostream & out, const char * function, int verbosity )
+    print_function( std::string & out, const char * function, int verbosity )
     {
 	if ( verbosity )
         {
-	    out << function;
+	    out.append( function );
             return;
         }
         
@@ -72,31 +40,56 @@ namespace
 	        }
 	        --beg;
 	    }
-            out.write( beg, end - beg );
-            out << "(...)";
+            out.append( beg, end - beg );
+            out.append( "(...)" );
 	} else {
-	    out << function;
+	    out.append( function );
 	}
     }
 }
 
+/** Returns the stack frames of this context as text. Depending on the ERS configuration each frame
+  * is either resolved to a symbolic name using the process wide symbol cache or is printed as a module
+  * relative record, which can be resolved later by the ers_symbolize utility. Frames of a context, which
+  * has been received from another process, can not be resolved locally and are always printed as records.
+  * \see ers::Configuration::raw_stack
+  */
 std::vector<std::string>
 ers::Context::stack( ) const
 {
     std::vector<std::string>	stack;
-    stack.reserve( stack_size() );
-    char ** symbols = backtrace_symbols( (void**)stack_symbols(), stack_size() );
-    
-    if (symbols) {
-        for (int i = 1; i < stack_size(); i++) {
-            stack.push_back( demangle(symbols[i]) );
-        }
-        free(symbols);
+    if ( !stack_size() || ers::Configuration::instance().raw_stack() )
+    {
+	for ( const Frame & frame : frames() )
+	{
+	    std::ostringstream out;
+	    out << frame;
+	    stack.push_back( out.str() );
+	}
+    }
+    else
+    {
+	stack.reserve( stack_size() - 1 );
+	ers::Symbolizer & symbolizer = ers::Symbolizer::instance();
+	for (int i = 1; i < stack_size(); i++) {
+	    stack.push_back( symbolizer.symbol( stack_symbols()[i] ) );
+	}
     }
 
     return stack;
 }
 
+std::vector<ers::Frame>
+ers::Context::frames( ) const
+{
+    std::vector<Frame>	frames;
+    ers::Symbolizer & symbolizer = ers::Symbolizer::instance();
+    for (int i = 1; i < stack_size(); i++) {
+	frames.push_back( symbolizer.frame( stack_symbols()[i] ) );
+    }
+    return frames;
+}
+
 /** Pretty printed code position 
   * format: package_name/file_name:line_number <function_name>
   * \return reference to string containing format
@@ -104,19 +97,29 @@ ers::Context::stack( ) const
 std::string
 ers::Context::position( int verbosity ) const
 {
-    std::ostringstream out;
+    std::string out;
+    position( out, verbosity );
+    return out;
+}
+
+/** Appends the pretty printed code position to the given string. This function does not allocate
+  * memory if the string has enough capacity.
+  */
+void
+ers::Context::position( std::string & out, int verbosity ) const
+{
     print_function( out, function_name(), verbosity );
-    out << " at ";
+    out.append( " at " );
     
     const char * file = file_name();
     if (    file[0] == '.'
     	&&  file[1] == '.'
         &&  file[2] == '/' ) // file name starts with "../"
     {
-	out << package_name() << (file + 2);
+	out.append( package_name() ).append( file + 2 );
     } else {
-	out << file;
+	out.append( file );
     }
-    out << ":" << line_number();
-    return out.str();
+    out.push_back( ':' );
+    ers::fmt::append( out, (long long)line_number() );
 }
@@ -0,0 +1,109 @@
+/*
+ *  Format.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <charconv>
+#include <cstdint>
+
+#include <ers/internal/Format.h>
+
+namespace
+{
+    const size_t BuffersNumber = 4;
+
+    thread_local std::string	t_buffers[BuffersNumber];
+    thread_local size_t		t_depth;
+
+    template <class T>
+    void append_number( std::string & out, T value )
+    {
+	char buffer[64];
+	std::to_chars_result r = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+	out.append( buffer, r.ptr );
+    }
+}
+
+void
+ers::fmt::append( std::string & out, long long value )
+{
+    append_number( out, value );
+}
+
+void
+ers::fmt::append( std::string & out, unsigned long long value )
+{
+    append_number( out, value );
+}
+
+void
+ers::fmt::append( std::string & out, double value )
+{
+    append_number( out, value );
+}
+
+void
+ers::fmt::append( std::string & out, const void * value )
+{
+    out.append( "0x" );
+    char buffer[32];
+    std::to_chars_result r = std::to_chars( buffer, buffer + sizeof( buffer ), (uintptr_t)value, 16 );
+    out.append( buffer, r.ptr );
+}
+
+void
+ers::fmt::vformat_to( std::string & out, std::string_view format,
+			const void * const * values, const Appender * appenders, size_t count )
+{
+    size_t next = 0;
+    size_t start = 0;
+    for ( size_t i = 0; i < format.size(); ++i )
+    {
+	char c = format[i];
+	if ( c != '{' && c != '}' )
+	    continue;
+
+	out.append( format.data() + start, i - start );
+	start = ++i;
+	if ( i < format.size() && format[i] == c )
+	    continue;		// escaped brace, it is appended as part of the next chunk
+
+	size_t index = 0;
+	bool manual = false;
+	for ( ; i < format.size() && format[i] >= '0' && format[i] <= '9'; ++i )
+	{
+	    index = index * 10 + ( format[i] - '0' );
+	    manual = true;
+	}
+	if ( !manual )
+	    index = next++;
+
+	if ( index < count )
+	    appenders[index]( out, values[index] );
+	start = i + 1;
+    }
+    if ( start < format.size() )
+	out.append( format.data() + start, format.size() - start );
+}
+
+ers::fmt::Buffer::Buffer()
+{
+    if ( t_depth < BuffersNumber )
+    {
+	m_buffer = &t_buffers[t_depth];
+	m_buffer->clear();
+    }
+    else
+    {
+	m_buffer = &m_local;
+    }
+    ++t_depth;
+}
+
+ers::fmt::Buffer::~Buffer()
+{
+    --t_depth;
+}
@@ -12,6 +12,7 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <thread>
 #include <ctime>
 #include <time.h>
 
@@ -49,17 +50,32 @@ namespace
     }    
 }
 
+/** Copies of an issue share the same payload, so copying is cheap regardless of the size
+  * of the message, the number of attributes and the length of the cause chain.
+  * \param other the issue to be copied
+  */
 Issue::Issue( const Issue & other )
   : std::exception( other ),
-    m_cause( other.m_cause.get() ? other.m_cause->clone() : 0 ),
-    m_context( other.m_context->clone() ),
-    m_message( other.m_message ),
-    m_qualifiers( other.m_qualifiers ),
-    m_severity( other.m_severity ),
-    m_time( other.m_time ),
-    m_values( other.m_values )
-{ ; }
+    m_severity( other.m_severity )
+{
+    // the message must be rendered before the payload is shared
+    other.message();
+    m_payload = other.m_payload;
+}
 
+/** Since the payload is copied only when it is modified, moving an issue is the same as copying it.
+  * The other issue shares the payload with the new one and stays valid, so it can still be used,
+  * e.g. rethrown after being moved into the cause of another issue.
+  * \param other the issue to be moved
+  */
+Issue::Issue( Issue && other )
+  : std::exception( other ),
+    m_severity( other.m_severity )
+{
+    // the message renderer may refer to a temporary object in the scope of the original issue
+    other.message();
+    m_payload = other.m_payload;
+}
 
 /** This constructor create a new issue with the given message.
  * \param context the context of the Issue, e.g where in the code the issue appeared
@@ -67,12 +83,15 @@ Issue::Issue( const Issue & other )
  */
 Issue::Issue(	const Context & context,
 		const std::string & message )
-  : m_context( context.clone() ),
-    m_message( message ),
-    m_severity( ers::Error ),
-    m_time( system_clock::now() )
+  : m_payload( std::make_shared<Payload>() ),
+    m_severity( ers::Error )
 {
-    add_qualifier( m_context->package_name() );
+    m_payload->m_context.reset( context.clone() );
+    m_payload->m_message = message;
+    ers::clock::Timestamp now = ers::clock::now( ers::clock::source( ers::clock::current_severity() ) );
+    m_payload->m_time = now.m_time;
+    m_payload->m_monotonic = now.m_monotonic;
+    add_qualifier( context.package_name() );
     add_default_qualifiers( *this );
 }
 
@@ -82,15 +101,8 @@ Issue::Issue(	const Context & context,
  */
 Issue::Issue(	const Context & context,
                 const std::exception & cause )
-  : m_context( context.clone() ),
-    m_severity( ers::Error ),
-    m_time( system_clock::now() )
-{
-    const Issue * issue = dynamic_cast<const Issue *>( &cause );
-    m_cause.reset( issue ? issue->clone() : new StdIssue( ERS_HERE, cause.what() ) );
-    add_qualifier( m_context->package_name() );
-    add_default_qualifiers( *this );
-}
+  : Issue( context, std::string(), cause )
+{ ; }
 
 /** This constructor takes another exceptions as its cause.
  * \param context the context of the Issue, e.g where in the code did the issue appear  
@@ -100,15 +112,34 @@ Issue::Issue(	const Context & context,
 Issue::Issue(	const Context & context,
 		const std::string & message,
 		const std::exception & cause )
-  : m_context( context.clone() ),
-    m_message( message ),
-    m_severity( ers::Error ),
-    m_time( system_clock::now() )
+  : Issue( context, message )
 {
     const Issue * issue = dynamic_cast<const Issue *>( &cause );
-    m_cause.reset( issue ? issue->clone() : new StdIssue( ERS_HERE, cause.what() ) );
-    add_qualifier( m_context->package_name() );
-    add_default_qualifiers( *this );
+    m_payload->m_cause.reset( issue ? issue->clone() : new StdIssue( ERS_HERE, cause.what() ) );
+}
+
+/** This constructor takes another issue as its cause. The cause is moved into
+ * the new issue instead of being copied.
+ * \param context the context of the Issue, e.g where in the code the issue appeared
+ * \param cause the issue that has caused this one
+ */
+Issue::Issue(	const Context & context,
+                Issue && cause )
+  : Issue( context, std::string(), std::move( cause ) )
+{ ; }
+
+/** This constructor takes another issue as its cause. The cause is moved into
+ * the new issue instead of being copied.
+ * \param context the context of the Issue, e.g where in the code did the issue appear  
+ * \param message the user message associated with this issue
+ * \param cause the issue that has caused this one
+ */
+Issue::Issue(	const Context & context,
+		const std::string & message,
+		Issue && cause )
+  : Issue( context, message )
+{
+    m_payload->m_cause.reset( cause.move_clone() );
 }
 
 Issue::Issue(	Severity severity,
@@ -118,14 +149,16 @@ Issue::Issue(	Severity severity,
 		const std::vector<std::string> & qualifiers,
 		const std::map<std::string, std::string> & parameters,
 		const ers::Issue * cause )
-  : m_cause( cause ),
-    m_context( context.clone() ),
-    m_message( message ),
-    m_qualifiers( qualifiers ),
-    m_severity( severity ),
-    m_time( time ),
-    m_values( parameters )
-{ ; }
+  : m_payload( std::make_shared<Payload>() ),
+    m_severity( severity )
+{
+    m_payload->m_cause.reset( cause );
+    m_payload->m_context.reset( context.clone() );
+    m_payload->m_message = message;
+    m_payload->m_qualifiers = qualifiers;
+    m_payload->m_time = time;
+    m_payload->m_values = parameters;
+}
 
 ers::Issue::~Issue() noexcept
 { ; }
@@ -133,14 +166,14 @@ ers::Issue::~Issue() noexcept
 std::time_t 
 ers::Issue::time_t() const
 {
-    return system_clock::to_time_t(m_time);
+    return system_clock::to_time_t(m_payload->m_time);
 }
 
 void 
 ers::Issue::get_value( const std::string & key, const char * & value ) const
 {
-    string_map::const_iterator it = m_values.find(key);
-    if ( it != m_values.end() )
+    string_map::const_iterator it = m_payload->m_values.find(key);
+    if ( it != m_payload->m_values.end() )
     {
 	value = it->second.c_str();
     }
@@ -153,8 +186,8 @@ ers::Issue::get_value( const std::string & key, const char * & value ) const
 void 
 ers::Issue::get_value( const std::string & key, std::string & value ) const
 {
-    string_map::const_iterator it = m_values.find(key);
-    if ( it != m_values.end() )
+    string_map::const_iterator it = m_payload->m_values.find(key);
+    if ( it != m_payload->m_values.end() )
     {
 	value = it->second;
     }
@@ -170,8 +203,9 @@ ers::Issue::get_value( const std::string & key, std::string & value ) const
 void 
 Issue::add_qualifier( const std::string & qualifier )
 {
-    if ( std::find( m_qualifiers.begin(), m_qualifiers.end(), qualifier ) == m_qualifiers.end() ) {
-        m_qualifiers.push_back( qualifier );
+    const std::vector<std::string> & qualifiers = m_payload->m_qualifiers;
+    if ( std::find( qualifiers.begin(), qualifiers.end(), qualifier ) == qualifiers.end() ) {
+        mutable_payload().m_qualifiers.push_back( qualifier );
     }
 }
 
@@ -187,9 +221,11 @@ Issue::set_severity( ers::Severity severity ) const
   * \param msg text to be prepended
   */
 void
-Issue::prepend_message( const std::string & msg )
+Issue::prepend_message( std::string_view msg )
 {
-    m_message = msg + m_message;
+    // the text produced by the message renderer must follow the prepended one
+    message();
+    mutable_payload().m_message.insert( 0, msg );
 }
 
 /** Adds the given text strings to the beginning and to the end of the issue's message
@@ -199,7 +235,63 @@ Issue::prepend_message( const std::string & msg )
 void
 Issue::wrap_message( const std::string & begin, const std::string & end )
 {
-    m_message = begin + m_message + end;
+    std::string text = begin + message() + end;
+    mutable_payload().m_message.swap( text );
+}
+
+/** Returns the payload of this issue, which can be modified. If the payload is shared with
+  * other issues it is copied first.
+  */
+Issue::Payload &
+Issue::mutable_payload()
+{
+    if ( m_payload.use_count() > 1 )
+    {
+	m_payload = std::make_shared<Payload>( *m_payload );
+    }
+    return *m_payload;
+}
+
+/** Produces the message text with the help of the message renderer.
+  * The renderer is used only once, the result is kept in the issue.
+  * The payload of an issue, which has a renderer, is never shared.
+  * If several threads request the message at the same time, one of them renders it
+  * and the others wait until the text is ready. If the renderer throws, the exception
+  * is passed to the thread which has called it and one of the waiting threads tries again.
+  */
+void
+Issue::render_message() const
+{
+    int state = m_render_state.load( std::memory_order_acquire );
+    while ( state != Rendered )
+    {
+	if ( state == Pending
+	    && m_render_state.compare_exchange_weak( state, Rendering, std::memory_order_acquire ) )
+	{
+	    break;
+	}
+	if ( state == Rendering )
+	{
+	    std::this_thread::yield();
+	}
+	state = m_render_state.load( std::memory_order_acquire );
+    }
+    if ( state == Rendered )
+    {
+	return;
+    }
+
+    std::ostringstream out;
+    try {
+	m_renderer( out );
+    }
+    catch( ... ) {
+	m_render_state.store( Pending, std::memory_order_release );
+	throw;
+    }
+    m_renderer = MessageRenderer();
+    m_payload->m_message.insert( 0, out.str() );
+    m_render_state.store( Rendered, std::memory_order_release );
 }
 
 namespace ers
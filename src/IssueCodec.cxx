@@ -0,0 +1,630 @@
+/*
+ *  IssueCodec.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <string.h>
+
+#include <charconv>
+#include <memory>
+#include <vector>
+
+#include <ers/Issue.h>
+#include <ers/IssueFactory.h>
+#include <ers/RemoteContext.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/Symbolizer.h>
+
+namespace
+{
+    const int MaxCauseDepth = 64;
+
+    ////////////////////////////////////////////////////////////////////////
+    // Binary format
+    ////////////////////////////////////////////////////////////////////////
+
+    /** Calls the given function with the module path, build id and offset of every stack frame of the context.
+      * The frames of a local context are translated without copying the module attributes.
+      */
+    template <class F>
+    void for_each_frame( const ers::Context & context, F function )
+    {
+	if ( context.stack_size() )
+	{
+	    ers::Symbolizer::instance().visit( context.stack_symbols() + 1, context.stack_size() - 1, function );
+	}
+	else
+	{
+	    for ( const ers::Frame & frame : context.frames() )
+		function( frame.m_module, frame.m_build_id, frame.m_offset );
+	}
+    }
+
+    template <class T>
+    void put( std::string & out, T value )
+    {
+	out.append( reinterpret_cast<const char *>( &value ), sizeof( value ) );
+    }
+
+    void put_string( std::string & out, std::string_view value )
+    {
+	put<uint32_t>( out, value.size() );
+	out.append( value.data(), value.size() );
+    }
+
+    void put_body( std::string & out, const ers::Issue & issue )
+    {
+	const ers::Context & context = issue.context();
+
+	put<uint64_t>( out, ers::IssueFactory::type_id( issue.get_class_name() ) );
+	put_string( out, issue.get_class_name() );
+	put<uint8_t>( out, issue.severity().type );
+	put<int32_t>( out, issue.severity().rank );
+	put<int64_t>( out, std::chrono::duration_cast<std::chrono::nanoseconds>(
+				issue.ptime().time_since_epoch() ).count() );
+
+	put_string( out, context.package_name() );
+	put_string( out, context.file_name() );
+	put<int32_t>( out, context.line_number() );
+	put_string( out, context.function_name() );
+	put_string( out, context.host_name() );
+	put<int32_t>( out, context.process_id() );
+	put<int32_t>( out, context.thread_id() );
+	put_string( out, context.cwd() );
+	put<int32_t>( out, context.user_id() );
+	put_string( out, context.user_name() );
+	put_string( out, context.application_name() );
+
+	size_t start = out.size();
+	uint32_t frames = 0;
+	put<uint32_t>( out, frames );
+	for_each_frame( context,
+	    [&out, &frames]( const std::string & module, const std::string & build_id, uintptr_t offset )
+	    {
+		put_string( out, module );
+		put_string( out, build_id );
+		put<uint64_t>( out, offset );
+		++frames;
+	    } );
+	::memcpy( &out[start], &frames, sizeof( frames ) );
+
+	put_string( out, issue.message() );
+
+	put<uint32_t>( out, issue.qualifiers().size() );
+	for ( const std::string & q : issue.qualifiers() )
+	    put_string( out, q );
+
+	put<uint32_t>( out, issue.parameters().size() );
+	for ( const auto & p : issue.parameters() )
+	{
+	    put_string( out, p.first );
+	    put_string( out, p.second );
+	}
+
+	put<uint8_t>( out, issue.cause() != 0 );
+	if ( issue.cause() )
+	    put_body( out, *issue.cause() );
+    }
+
+    /** Reads values from a binary frame checking the frame boundaries.
+      */
+    struct Reader
+    {
+	Reader( const char * data, const char * end )
+	  : m_data( data ),
+	    m_end( end ),
+	    m_ok( true )
+	{ ; }
+
+	template <class T>
+	T get()
+	{
+	    T value = T();
+	    if ( m_ok && m_end - m_data >= (ptrdiff_t)sizeof( T ) )
+	    {
+		::memcpy( &value, m_data, sizeof( T ) );
+		m_data += sizeof( T );
+	    }
+	    else
+	    {
+		m_ok = false;
+	    }
+	    return value;
+	}
+
+	std::string string()
+	{
+	    uint32_t size = get<uint32_t>();
+	    if ( !m_ok || (size_t)( m_end - m_data ) < size )
+	    {
+		m_ok = false;
+		return std::string();
+	    }
+	    std::string value( m_data, size );
+	    m_data += size;
+	    return value;
+	}
+
+	const char *	m_data;
+	const char *	m_end;
+	bool		m_ok;
+    };
+
+    ers::Issue * get_body( Reader & in, int depth )
+    {
+	uint64_t id = in.get<uint64_t>();
+	std::string name = in.string();
+	ers::severity type = (ers::severity)in.get<uint8_t>();
+	int rank = in.get<int32_t>();
+	system_clock::time_point time( std::chrono::duration_cast<system_clock::duration>(
+					std::chrono::nanoseconds( in.get<int64_t>() ) ) );
+
+	std::string package = in.string();
+	std::string file = in.string();
+	int line = in.get<int32_t>();
+	std::string function = in.string();
+	std::string host = in.string();
+	int pid = in.get<int32_t>();
+	int tid = in.get<int32_t>();
+	std::string cwd = in.string();
+	int uid = in.get<int32_t>();
+	std::string user = in.string();
+	std::string application = in.string();
+
+	std::vector<ers::Frame> frames( std::min<uint32_t>( in.get<uint32_t>(), in.m_end - in.m_data ) );
+	for ( ers::Frame & frame : frames )
+	{
+	    frame.m_module = in.string();
+	    frame.m_build_id = in.string();
+	    frame.m_offset = in.get<uint64_t>();
+	}
+
+	std::string message = in.string();
+
+	std::vector<std::string> qualifiers( std::min<uint32_t>( in.get<uint32_t>(), in.m_end - in.m_data ) );
+	for ( std::string & q : qualifiers )
+	    q = in.string();
+
+	ers::string_map parameters;
+	for ( uint32_t n = in.get<uint32_t>(); in.m_ok && n; --n )
+	{
+	    std::string key = in.string();
+	    parameters.emplace_hint( parameters.end(), std::move( key ), in.string() );
+	}
+
+	std::unique_ptr<ers::Issue> cause;
+	if ( in.get<uint8_t>() && depth < MaxCauseDepth )
+	{
+	    cause.reset( get_body( in, depth + 1 ) );
+	    if ( !cause )
+		return 0;
+	}
+
+	if ( !in.m_ok || type < ers::Debug || type > ers::Fatal )
+	    return 0;
+
+	ers::RemoteContext context( package, file, line, function,
+		ers::RemoteProcessContext( host, pid, tid, cwd, uid, user, application ), std::move( frames ) );
+	return ers::IssueFactory::instance().create( id, name, context, ers::Severity( type, rank ), time,
+		std::move( message ), std::move( qualifiers ), std::move( parameters ), cause.release() );
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // JSON format
+    ////////////////////////////////////////////////////////////////////////
+
+    void put_json( std::string & out, std::string_view value )
+    {
+	static const char digits[] = "0123456789abcdef";
+	out.push_back( '"' );
+	for ( char c : value )
+	{
+	    switch ( c )
+	    {
+		case '"':  out.append( "\\\"" ); break;
+		case '\\': out.append( "\\\\" ); break;
+		case '\n': out.append( "\\n" ); break;
+		case '\r': out.append( "\\r" ); break;
+		case '\t': out.append( "\\t" ); break;
+		default:
+		    if ( (unsigned char)c < 0x20 )
+		    {
+			out.append( "\\u00" );
+			out.push_back( digits[c >> 4] );
+			out.push_back( digits[c & 0xf] );
+		    }
+		    else
+		    {
+			out.push_back( c );
+		    }
+	    }
+	}
+	out.push_back( '"' );
+    }
+
+    void put_json( std::string & out, long long value )
+    {
+	char buf[32];
+	out.append( buf, std::to_chars( buf, buf + sizeof( buf ), value ).ptr );
+    }
+
+    void put_json_field( std::string & out, const char * name, std::string_view value )
+    {
+	out.push_back( ',' );
+	put_json( out, name );
+	out.push_back( ':' );
+	put_json( out, value );
+    }
+
+    void put_json_field( std::string & out, const char * name, long long value )
+    {
+	out.push_back( ',' );
+	put_json( out, name );
+	out.push_back( ':' );
+	put_json( out, value );
+    }
+
+    void put_json_body( std::string & out, const ers::Issue & issue )
+    {
+	const ers::Context & context = issue.context();
+
+	out.append( "{\"class\":" );
+	put_json( out, issue.get_class_name() );
+	put_json_field( out, "severity", ers::to_string( issue.severity().type ) );
+	put_json_field( out, "rank", issue.severity().rank );
+	put_json_field( out, "time", std::chrono::duration_cast<std::chrono::nanoseconds>(
+					issue.ptime().time_since_epoch() ).count() );
+	put_json_field( out, "message", issue.message() );
+
+	out.append( ",\"context\":{\"package\":" );
+	put_json( out, context.package_name() );
+	put_json_field( out, "file", context.file_name() );
+	put_json_field( out, "line", context.line_number() );
+	put_json_field( out, "function", context.function_name() );
+	put_json_field( out, "host", context.host_name() );
+	put_json_field( out, "pid", context.process_id() );
+	put_json_field( out, "tid", context.thread_id() );
+	put_json_field( out, "cwd", context.cwd() );
+	put_json_field( out, "uid", context.user_id() );
+	put_json_field( out, "user", context.user_name() );
+	put_json_field( out, "application", context.application_name() );
+
+	bool first = true;
+	for_each_frame( context,
+	    [&out, &first]( const std::string & module, const std::string & build_id, uintptr_t offset )
+	    {
+		out.append( first ? ",\"frames\":[{\"module\":" : ",{\"module\":" );
+		put_json( out, module );
+		put_json_field( out, "build_id", build_id );
+		put_json_field( out, "offset", (long long)offset );
+		out.push_back( '}' );
+		first = false;
+	    } );
+	if ( !first )
+	    out.push_back( ']' );
+	out.push_back( '}' );
+
+	out.append( ",\"qualifiers\":[" );
+	for ( size_t i = 0; i < issue.qualifiers().size(); ++i )
+	{
+	    if ( i )
+		out.push_back( ',' );
+	    put_json( out, issue.qualifiers()[i] );
+	}
+	out.push_back( ']' );
+
+	out.append( ",\"parameters\":{" );
+	for ( auto it = issue.parameters().begin(); it != issue.parameters().end(); ++it )
+	{
+	    if ( it != issue.parameters().begin() )
+		out.push_back( ',' );
+	    put_json( out, it->first );
+	    out.push_back( ':' );
+	    put_json( out, it->second );
+	}
+	out.push_back( '}' );
+
+	if ( issue.cause() )
+	{
+	    out.append( ",\"cause\":" );
+	    put_json_body( out, *issue.cause() );
+	}
+	out.push_back( '}' );
+    }
+
+    /** A minimal JSON parser, which supports the subset of JSON produced by the encoder:
+      * objects, arrays, strings and integer numbers.
+      */
+    struct JsonValue
+    {
+	enum Type { Null, String, Number, Array, Object };
+
+	Type						m_type = Null;
+	std::string					m_string;	/**< \brief string or number text */
+	std::vector<JsonValue>				m_array;
+	std::vector<std::pair<std::string, JsonValue> >	m_object;
+
+	const JsonValue * find( std::string_view key ) const
+	{
+	    for ( const auto & p : m_object )
+		if ( p.first == key )
+		    return &p.second;
+	    return 0;
+	}
+
+	std::string string( std::string_view key ) const
+	{
+	    const JsonValue * v = find( key );
+	    return v && v->m_type == String ? v->m_string : std::string();
+	}
+
+	long long number( std::string_view key ) const
+	{
+	    const JsonValue * v = find( key );
+	    long long result = 0;
+	    if ( v && v->m_type == Number )
+		std::from_chars( v->m_string.data(), v->m_string.data() + v->m_string.size(), result );
+	    return result;
+	}
+    };
+
+    struct JsonParser
+    {
+	explicit JsonParser( std::string_view text )
+	  : m_data( text.data() ),
+	    m_end( text.data() + text.size() ),
+	    m_depth( 0 )
+	{ ; }
+
+	void skip()
+	{
+	    while ( m_data < m_end && ( *m_data == ' ' || *m_data == '\t' || *m_data == '\n' || *m_data == '\r' ) )
+		++m_data;
+	}
+
+	bool expect( char c )
+	{
+	    skip();
+	    if ( m_data < m_end && *m_data == c )
+	    {
+		++m_data;
+		return true;
+	    }
+	    return false;
+	}
+
+	bool parse_string( std::string & out )
+	{
+	    if ( !expect( '"' ) )
+		return false;
+	    while ( m_data < m_end && *m_data != '"' )
+	    {
+		char c = *m_data++;
+		if ( c != '\\' )
+		{
+		    out.push_back( c );
+		    continue;
+		}
+		if ( m_data == m_end )
+		    return false;
+		switch ( c = *m_data++ )
+		{
+		    case 'n': out.push_back( '\n' ); break;
+		    case 'r': out.push_back( '\r' ); break;
+		    case 't': out.push_back( '\t' ); break;
+		    case 'b': out.push_back( '\b' ); break;
+		    case 'f': out.push_back( '\f' ); break;
+		    case 'u':
+			{
+			    unsigned code = 0;
+			    if ( m_end - m_data < 4
+				|| std::from_chars( m_data, m_data + 4, code, 16 ).ptr != m_data + 4 )
+				return false;
+			    m_data += 4;
+			    // encode the code point as UTF-8, surrogate pairs are not supported
+			    if ( code < 0x80 ) {
+				out.push_back( code );
+			    } else if ( code < 0x800 ) {
+				out.push_back( 0xc0 | ( code >> 6 ) );
+				out.push_back( 0x80 | ( code & 0x3f ) );
+			    } else {
+				out.push_back( 0xe0 | ( code >> 12 ) );
+				out.push_back( 0x80 | ( ( code >> 6 ) & 0x3f ) );
+				out.push_back( 0x80 | ( code & 0x3f ) );
+			    }
+			}
+			break;
+		    default: out.push_back( c );
+		}
+	    }
+	    return expect( '"' );
+	}
+
+	bool parse( JsonValue & value )
+	{
+	    skip();
+	    if ( m_data == m_end || ++m_depth > 2 * MaxCauseDepth )
+		return false;
+
+	    bool result = false;
+	    char c = *m_data;
+	    if ( c == '"' )
+	    {
+		value.m_type = JsonValue::String;
+		result = parse_string( value.m_string );
+	    }
+	    else if ( c == '{' )
+	    {
+		++m_data;
+		value.m_type = JsonValue::Object;
+		result = expect( '}' );
+		while ( !result )
+		{
+		    std::pair<std::string, JsonValue> member;
+		    if ( !parse_string( member.first ) || !expect( ':' ) || !parse( member.second ) )
+			break;
+		    value.m_object.push_back( std::move( member ) );
+		    result = expect( '}' );
+		    if ( !result && !expect( ',' ) )
+			break;
+		}
+	    }
+	    else if ( c == '[' )
+	    {
+		++m_data;
+		value.m_type = JsonValue::Array;
+		result = expect( ']' );
+		while ( !result )
+		{
+		    value.m_array.emplace_back();
+		    if ( !parse( value.m_array.back() ) )
+			break;
+		    result = expect( ']' );
+		    if ( !result && !expect( ',' ) )
+			break;
+		}
+	    }
+	    else if ( c == '-' || ( c >= '0' && c <= '9' ) )
+	    {
+		const char * begin = m_data++;
+		while ( m_data < m_end && ( ( *m_data >= '0' && *m_data <= '9' )
+			|| *m_data == '.' || *m_data == 'e' || *m_data == 'E' || *m_data == '+' || *m_data == '-' ) )
+		    ++m_data;
+		value.m_type = JsonValue::Number;
+		value.m_string.assign( begin, m_data );
+		result = true;
+	    }
+	    else if ( m_end - m_data >= 4 && !::memcmp( m_data, "null", 4 ) )
+	    {
+		m_data += 4;
+		result = true;
+	    }
+	    --m_depth;
+	    return result;
+	}
+
+	const char *	m_data;
+	const char *	m_end;
+	int		m_depth;
+    };
+
+    ers::Issue * get_json_body( const JsonValue & value )
+    {
+	if ( value.m_type != JsonValue::Object )
+	    return 0;
+
+	std::unique_ptr<ers::Issue> cause;
+	if ( const JsonValue * c = value.find( "cause" ) )
+	{
+	    cause.reset( get_json_body( *c ) );
+	    if ( !cause )
+		return 0;
+	}
+
+	ers::Severity severity( ers::Error );
+	try
+	{
+	    ers::severity type;
+	    severity = ers::Severity( ers::parse( value.string( "severity" ), type ), value.number( "rank" ) );
+	}
+	catch( ers::Issue & )
+	{
+	    return 0;
+	}
+
+	std::vector<std::string> qualifiers;
+	if ( const JsonValue * q = value.find( "qualifiers" ) )
+	{
+	    for ( const JsonValue & v : q->m_array )
+		qualifiers.push_back( v.m_string );
+	}
+
+	ers::string_map parameters;
+	if ( const JsonValue * p = value.find( "parameters" ) )
+	{
+	    for ( const auto & v : p->m_object )
+		parameters.emplace( v.first, v.second.m_string );
+	}
+
+	JsonValue empty;
+	const JsonValue * c = value.find( "context" );
+	const JsonValue & context = c ? *c : empty;
+
+	std::vector<ers::Frame> frames;
+	if ( const JsonValue * f = context.find( "frames" ) )
+	{
+	    for ( const JsonValue & v : f->m_array )
+		frames.push_back( ers::Frame{ v.string( "module" ), v.string( "build_id" ), (uintptr_t)v.number( "offset" ) } );
+	}
+
+	ers::RemoteContext remote( context.string( "package" ), context.string( "file" ),
+		context.number( "line" ), context.string( "function" ),
+		ers::RemoteProcessContext( context.string( "host" ), context.number( "pid" ), context.number( "tid" ),
+			context.string( "cwd" ), context.number( "uid" ), context.string( "user" ),
+			context.string( "application" ) ), std::move( frames ) );
+
+	system_clock::time_point time( std::chrono::duration_cast<system_clock::duration>(
+					std::chrono::nanoseconds( value.number( "time" ) ) ) );
+	std::string name = value.string( "class" );
+
+	return ers::IssueFactory::instance().create( ers::IssueFactory::type_id( name ), name, remote, severity, time,
+		value.string( "message" ), std::move( qualifiers ), std::move( parameters ), cause.release() );
+    }
+}
+
+void
+ers::codec::encode_binary( const Issue & issue, std::string & out )
+{
+    size_t start = out.size();
+    put<uint32_t>( out, 0 );
+    put_body( out, issue );
+    uint32_t size = out.size() - start - sizeof( uint32_t );
+    ::memcpy( &out[start], &size, sizeof( size ) );
+}
+
+size_t
+ers::codec::binary_frame_size( const char * data, const char * end )
+{
+    uint32_t size;
+    if ( end - data < (ptrdiff_t)sizeof( size ) )
+	return 0;
+
+    ::memcpy( &size, data, sizeof( size ) );
+    if ( (size_t)( end - data ) - sizeof( size ) < size )
+	return 0;
+
+    return size + sizeof( size );
+}
+
+ers::Issue *
+ers::codec::decode_binary( const char * & data, const char * end )
+{
+    size_t size = binary_frame_size( data, end );
+    if ( !size )
+	return 0;
+
+    Reader in( data + sizeof( uint32_t ), data + size );
+    data += size;
+    return get_body( in, 0 );
+}
+
+void
+ers::codec::encode_json( const Issue & issue, std::string & out )
+{
+    put_json_body( out, issue );
+    out.push_back( '\n' );
+}
+
+ers::Issue *
+ers::codec::decode_json( std::string_view record )
+{
+    JsonParser parser( record );
+    JsonValue value;
+    if ( !parser.parse( value ) )
+	return 0;
+
+    return get_json_body( value );
+}
@@ -8,6 +8,9 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
+
 #include <ers/ers.h>
 #include <ers/IssueFactory.h>
 #include <ers/StreamFactory.h>
@@ -33,13 +36,67 @@ ers::IssueFactory::instance()
 void 
 ers::IssueFactory::register_issue( const std::string & name, IssueCreator creator )
 {
-    FunctionMap::const_iterator it = m_creators.find(name); 
-    if ( it == m_creators.end() )
+    TypeId id = type_id( name );
+    if ( find( id, name ) )
+    {
+	return;
+    }
+
+    // keep the load factor below 1/2
+    if ( ( m_entries.size() + 1 ) * 2 > m_table.size() )
+    {
+	rehash( std::max<size_t>( m_table.size() * 2, 64 ) );
+    }
+
+    m_entries.push_back( Entry{ name, id, creator } );
+    size_t mask = m_table.size() - 1;
+    size_t i = id & mask;
+    while ( m_table[i] )
+    {
+	i = ( i + 1 ) & mask;
+    }
+    m_table[i] = m_entries.size();
+}
+
+void
+ers::IssueFactory::rehash( size_t size )
+{
+    m_table.assign( size, 0 );
+    size_t mask = size - 1;
+    for ( size_t e = 0; e < m_entries.size(); ++e )
     {
-	m_creators[name] = creator;
+	size_t i = m_entries[e].m_id & mask;
+	while ( m_table[i] )
+	{
+	    i = ( i + 1 ) & mask;
+	}
+	m_table[i] = e + 1;
     }
 }
 
+/** Looks for the issue type with the given id. If the name is not empty it is also compared
+  * with the registered one, which resolves possible collisions of the type ids.
+  */
+const ers::IssueFactory::Entry *
+ers::IssueFactory::find( TypeId id, std::string_view name ) const
+{
+    if ( m_table.empty() )
+    {
+	return 0;
+    }
+
+    size_t mask = m_table.size() - 1;
+    for ( size_t i = id & mask; m_table[i]; i = ( i + 1 ) & mask )
+    {
+	const Entry & entry = m_entries[m_table[i] - 1];
+	if ( entry.m_id == id && ( name.empty() || entry.m_name == name ) )
+	{
+	    return &entry;
+	}
+    }
+    return 0;
+}
+
 /** Builds an issue out of the name it was registered with 
   * \param name the name used to indentify the class 
   * \return an newly allocated instance of type \c name or AnyIssue 
@@ -49,15 +106,29 @@ ers::Issue *
 ers::IssueFactory::create(	const std::string & name,
 				const ers::Context & context ) const
 {
-    FunctionMap::const_iterator it = m_creators.find(name); 
-    if ( it == m_creators.end() )
+    return create( type_id( name ), name, context );
+}
+
+/** Builds an issue out of the type id it was registered with 
+  * \param id the type id of the class 
+  * \param name the name of the class, which is used to verify the type found by id or to create AnyIssue
+  * \return an newly allocated instance of type \c name or AnyIssue 
+  * \note If the requested type cannot be resolved an instance of type AnyIssue 
+  */
+ers::Issue * 
+ers::IssueFactory::create(	TypeId id,
+				const std::string & name,
+				const ers::Context & context ) const
+{
+    const Entry * entry = find( id, name );
+    if ( !entry )
     {
 	ERS_INTERNAL_DEBUG( 1, "Creator for the \"" << name << "\" issue is not found" );
         return new ers::AnyIssue( name, context );
     }
     
     ERS_INTERNAL_DEBUG( 2, "Creating the \"" << name << "\" issue" );
-    return (it->second)( context ); 
+    return (entry->m_creator)( context ); 
 }
 
 
@@ -71,13 +142,32 @@ ers::IssueFactory::create(	const std::string & name,
 				const ers::string_map & parameters,
                                 const Issue * cause ) const
 {
-    ers::Issue * issue = create( name, context );
-    issue->m_message = message;
+    return create( type_id( name ), name, context, severity, time,
+		std::string( message ), std::vector<std::string>( qualifiers ), ers::string_map( parameters ), cause );
+}
+
+/** Builds an issue out of the decoded fields, which are moved into the new issue
+  * without being copied.
+  */
+ers::Issue *
+ers::IssueFactory::create(	TypeId id,
+				const std::string & name,
+				const ers::Context & context,
+                                Severity severity,
+                                const system_clock::time_point & time,
+				std::string && message,
+				std::vector<std::string> && qualifiers,
+				ers::string_map && parameters,
+                                const Issue * cause ) const
+{
+    ers::Issue * issue = create( id, name, context );
+    ers::Issue::Payload & payload = issue->mutable_payload();
+    payload.m_message = std::move( message );
+    payload.m_qualifiers = std::move( qualifiers );
+    payload.m_values = std::move( parameters );
+    payload.m_time = time;
+    payload.m_monotonic = std::chrono::steady_clock::time_point();	// not meaningful for the remote issues
+    payload.m_cause.reset( cause );
     issue->m_severity = severity;
-    issue->m_qualifiers = qualifiers;
-    issue->m_values = parameters;
-    issue->m_time = time;
-    issue->m_cause.reset( cause );
     return issue;
 }
-
@@ -7,10 +7,12 @@
  *
  */
 #include <sys/types.h>
+#include <pthread.h>
 #include <pwd.h>
 #include <unistd.h>
 #include <stdlib.h>
 
+#include <atomic>
 #include <iterator>
 
 #include <ers/LocalContext.h>
@@ -35,6 +37,37 @@ pid_t gettid() {
 
 namespace
 {
+    thread_local pid_t		t_thread_id;
+    std::atomic<pid_t>		g_process_id;
+    std::atomic<const char *>	g_application_name;
+
+    pid_t get_thread_id()
+    {
+	if ( !t_thread_id )
+	    t_thread_id = gettid();
+	return t_thread_id;
+    }
+
+    pid_t get_process_id()
+    {
+	pid_t pid = g_process_id.load( std::memory_order_relaxed );
+	if ( !pid )
+	{
+	    pid = ::getpid();
+	    g_process_id.store( pid, std::memory_order_relaxed );
+	}
+	return pid;
+    }
+
+    const char * get_application_name()
+    {
+	const char * name = ::getenv( "TDAQ_APPLICATION_NAME" );
+	return name ? name : "Undefined";
+    }
+
+    // The cached values must not be inherited by the child process
+    const int fork_handler_registered = pthread_atfork( 0, 0, &ers::LocalContext::resetProcessContext );
+
     const char * get_cwd( )
     {
 	static std::string buf;
@@ -83,21 +116,34 @@ ers::LocalContext::LocalContext(
     m_file_name( filename ),
     m_function_name( function_name ),
     m_line_number( line_number ),
-    m_thread_id( gettid() ),
+    m_thread_id( get_thread_id() ),
     m_stack_size( debug ? backtrace( m_stack, std::size(m_stack) ) : 0)
 { ; }
 
+void
+ers::LocalContext::resetProcessContext()
+{
+    t_thread_id = 0;
+    g_process_id.store( 0, std::memory_order_relaxed );
+    g_application_name.store( 0, std::memory_order_release );
+}
+
+pid_t
+ers::LocalContext::process_id() const
+{
+    return get_process_id();
+}
+
 const char *
 ers::LocalContext::application_name() const
 {
-    static int pid = ::getpid();
-    static const char * env = ::getenv( "TDAQ_APPLICATION_NAME" ) ? ::getenv( "TDAQ_APPLICATION_NAME" ) : "Undefined";
-
-    if (pid != ::getpid()) {
-    	pid = ::getpid();
-	env = ::getenv( "TDAQ_APPLICATION_NAME" ) ? ::getenv( "TDAQ_APPLICATION_NAME" ) : "Undefined";
+    const char * name = g_application_name.load( std::memory_order_acquire );
+    if ( !name )
+    {
+	name = get_application_name();
+	g_application_name.store( name, std::memory_order_release );
     }
-    return env;
+    return name;
 }
 
 const ers::LocalProcessContext	ers::LocalContext::c_process(	get_host_name(),
@@ -9,6 +9,15 @@
 #include <ers/LocalStream.h>
 #include <ers/StreamManager.h>
 #include <ers/internal/SingletonCreator.h>
+#include <ers/internal/Util.h>
+
+namespace
+{
+    /** Maximum number of issues of the same severity, which are dispatched without checking
+      * whether an issue of a higher severity has arrived
+      */
+    const size_t MaxBatchSize = 16;
+}
 
 /** This method returns the singleton instance.
   * It should be used for every operation on the factory.
@@ -28,7 +37,10 @@ ers::LocalStream::instance()
   * \see instance()
   */
 ers::LocalStream::LocalStream( )
-  : m_terminated( false )
+  : m_terminated( false ),
+    m_queues{},
+    m_weight( std::max( ers::read_from_environment( "TDAQ_ERS_CATCHER_WEIGHT", 0 ), 0 ) ),
+    m_credit( m_weight )
 { }
 
 ers::LocalStream::~LocalStream( )
@@ -54,23 +66,83 @@ ers::LocalStream::remove_issue_catcher( )
     catcher -> join();
 }
 
+/** Chooses the queue, from which the next issues are dispatched. Fatal issues are always taken first.
+  * In the weighted mode one issue from the next lower non-empty queue is taken after \c m_weight issues
+  * have been taken from the higher one.
+  * \param count is set to the number of issues to be taken from the chosen queue
+  * \return severity of the chosen queue or -1 if all the queues are empty
+  */
+int
+ers::LocalStream::select_queue( size_t & count )
+{
+    int highest = ers::Fatal;
+    while ( highest >= 0 && m_queues[highest].m_issues.empty() )
+	--highest;
+
+    if ( highest < 0 )
+	return highest;
+
+    // issues of the same severity are taken in small batches, so the reporting threads contend
+    // for the lock less often, while a more severe issue still overtakes the queued ones quickly
+    count = std::min( m_queues[highest].m_issues.size(), MaxBatchSize );
+    if ( highest == ers::Fatal || !m_weight )
+	return highest;
+
+    int lower = highest - 1;
+    while ( lower >= 0 && m_queues[lower].m_issues.empty() )
+	--lower;
+
+    if ( lower < 0 )
+    {
+	m_credit = m_weight;
+	return highest;
+    }
+
+    if ( !m_credit )
+    {
+	m_credit = m_weight;
+	count = 1;
+	return lower;
+    }
+
+    count = std::min<size_t>( count, m_credit );
+    m_credit -= count;
+    return highest;
+}
+
 void
 ers::LocalStream::thread_wrapper()
 {
+    std::vector<ers::Issue *> batch;
     std::unique_lock lock( m_mutex );
     m_catcher_thread_id = std::this_thread::get_id();
     while( !m_terminated )
     {
-	m_condition.wait( lock, [this](){return !m_issues.empty() || m_terminated;} );
+	int type;
+	size_t count;
+	m_condition.wait( lock, [&](){ return ( type = select_queue( count ) ) >= 0 || m_terminated; } );
         
-        while( !m_terminated && !m_issues.empty() )
+        if ( !m_terminated )
         {
-            ers::Issue * issue = m_issues.front();
-            m_issues.pop();
+            Queue & queue = m_queues[type];
+            auto now = std::chrono::steady_clock::now();
+            for ( size_t i = 0; i < count; ++i )
+            {
+		auto latency = now - queue.m_issues.front().second;
+		queue.m_statistics.m_total_latency += latency;
+		queue.m_statistics.m_max_latency = std::max( queue.m_statistics.m_max_latency, latency );
+		batch.push_back( queue.m_issues.front().first );
+		queue.m_issues.pop_front();
+            }
+            queue.m_statistics.m_dispatched += count;
             
             lock.unlock();            
-            m_issue_catcher( *issue );
-	    delete issue;
+            for ( ers::Issue * issue : batch )
+            {
+		m_issue_catcher( *issue );
+		delete issue;
+            }
+            batch.clear();
             lock.lock();            
         }
     }
@@ -99,8 +171,9 @@ ers::LocalStream::report_issue( ers::severity type, const ers::Issue & issue )
     {
 	ers::Issue * clone = issue.clone();
 	clone->set_severity( type );
+	auto now = std::chrono::steady_clock::now();
 	std::unique_lock lock( m_mutex );
-	m_issues.push( clone );
+	enqueue( clone, now );
 	m_condition.notify_one();
     }
     else
@@ -109,6 +182,57 @@ ers::LocalStream::report_issue( ers::severity type, const ers::Issue & issue )
     }
 }
 
+void 
+ers::LocalStream::enqueue( ers::Issue * issue, std::chrono::steady_clock::time_point time )
+{
+    m_queues[issue->severity().type].m_issues.emplace_back( issue, time );
+}
+
+ers::LocalStream::Statistics
+ers::LocalStream::statistics( ers::severity type ) const
+{
+    std::unique_lock lock( m_mutex );
+    Statistics statistics = m_queues[type].m_statistics;
+    statistics.m_pending = m_queues[type].m_issues.size();
+    return statistics;
+}
+
+void
+ers::LocalStream::dispatch_weight( unsigned int weight )
+{
+    std::unique_lock lock( m_mutex );
+    m_weight = weight;
+    m_credit = weight;
+}
+
+/** Passes several issues to the issue catcher queue under a single lock or directly to the
+  * corresponding stream if there is no issue catcher.
+  */
+void 
+ers::LocalStream::report_batch( ers::severity type, const ers::Issue * const * issues, size_t count )
+{
+    if ( m_issue_catcher_thread.get() && m_catcher_thread_id != std::this_thread::get_id() )
+    {
+	std::vector<ers::Issue *> clones( count );
+	for ( size_t i = 0; i < count; ++i )
+	{
+	    clones[i] = issues[i]->clone();
+	    clones[i]->set_severity( type );
+	}
+	auto now = std::chrono::steady_clock::now();
+	std::unique_lock lock( m_mutex );
+	for ( ers::Issue * clone : clones )
+	{
+	    enqueue( clone, now );
+	}
+	m_condition.notify_one();
+    }
+    else
+    {
+	StreamManager::instance().report_batch( type, issues, count );
+    }
+}
+
 void 
 ers::LocalStream::error( const ers::Issue & issue )
 {
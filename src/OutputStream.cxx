@@ -30,6 +30,15 @@ ers::OutputStream::chained( OutputStream * stream )
     m_chained.reset( stream );
 }
 
+void
+ers::OutputStream::write_batch( const Issue * const * issues, size_t count )
+{
+    for ( size_t i = 0; i < count; ++i )
+    {
+	write( *issues[i] );
+    }
+}
+
 bool
 ers::OutputStream::isNull() const
 {
@@ -11,9 +11,14 @@
 namespace
 {
     const char * const SEPARATOR = ":";
-    const char * const DefaultLibraryName = "ErsBaseStreams";
-    const char * const MRSStreamLibraryName = "mtsStreams";
     const char * const EnvironmentName = "TDAQ_ERS_STREAM_LIBS";
+
+    /** Streams implemented by the libraries built together with ERS. The list of the ErsBaseStreams
+      * streams is generated from the stream registrations at build time.
+      */
+    const char * const BuiltinManifest[][2] = {
+#include "StreamManifest.h"
+    };
 }
 
 namespace ers
@@ -57,35 +62,76 @@ namespace ers
 
     PluginManager::PluginManager( )
     {
-	const char * env = ::getenv( EnvironmentName );
-        std::string config( env ? std::string( env ) + SEPARATOR + DefaultLibraryName : DefaultLibraryName );
-        
-        std::vector<std::string> libs;
-    	ers::tokenize( config, SEPARATOR, libs );
-        
-	try
+	for ( size_t i = 0; i < sizeof( BuiltinManifest ) / sizeof( BuiltinManifest[0] ); i++ )
 	{
-	    libraries_[MRSStreamLibraryName] = new SharedLibrary( MRSStreamLibraryName );
+	    manifest_[BuiltinManifest[i][0]] = BuiltinManifest[i][1];
 	}
-	catch( PluginException & ex )
+
+	const char * env = ::getenv( EnvironmentName );
+	if ( !env )
 	{
-	    ERS_INTERNAL_DEBUG( 1, "Library " << MRSStreamLibraryName << " can not be loaded because " << ex.reason() )
+	    return;
 	}
-        
+
+	std::vector<std::string> libs;
+	ers::tokenize( env, SEPARATOR, libs );
+
 	for ( size_t i = 0; i < libs.size(); i++ )
 	{
-	    LibMap::iterator it = libraries_.find( libs[i] );
-	    if ( it == libraries_.end() )
+	    std::string::size_type pos = libs[i].find( '=' );
+	    if ( pos == std::string::npos )
 	    {
-		try
-                {
-                    libraries_[libs[i]] = new SharedLibrary( libs[i] );
-                }
-                catch( PluginException & ex )
-                {
-		    ERS_INTERNAL_ERROR( "Library " << libs[i] << " can not be loaded because " << ex.reason() )
-                }
+		unlisted_.push_back( libs[i] );
+		continue;
 	    }
+
+	    std::string library = libs[i].substr( 0, pos );
+	    std::vector<std::string> streams;
+	    ers::tokenize( libs[i].substr( pos + 1 ), ",", streams );
+	    for ( size_t j = 0; j < streams.size(); j++ )
+	    {
+		manifest_[streams[j]] = library;
+	    }
+	}
+    }
+
+    bool PluginManager::load( const std::string & name )
+    {
+	if ( libraries_.find( name ) != libraries_.end() )
+	{
+	    return false;
 	}
+
+	SharedLibrary * library = 0;
+	try
+	{
+	    library = new SharedLibrary( name );
+	}
+	catch( PluginException & ex )
+	{
+	    ERS_INTERNAL_ERROR( "Library " << name << " can not be loaded because " << ex.reason() )
+	}
+
+	// failed libraries are remembered as well, so that they are not tried again
+	libraries_[name] = library;
+	return library != 0;
+    }
+
+    bool PluginManager::load_stream( const std::string & stream )
+    {
+	Manifest::const_iterator it = manifest_.find( stream );
+	if ( it != manifest_.end() )
+	{
+	    return load( it->second );
+	}
+
+	bool loaded = false;
+	for ( size_t i = 0; i < unlisted_.size(); i++ )
+	{
+	    loaded = load( unlisted_[i] ) || loaded;
+	}
+	unlisted_.clear();
+
+	return loaded;
     }
 }
@@ -33,6 +33,18 @@ ers::to_string( ers::severity severity )
     return SeverityNames[severity];
 }
 
+/** 
+ * \brief Returns the name of the severity type
+ * \param s severity
+ * \return view of the static string with the severity name
+ */
+std::string_view
+ers::severity_name( ers::severity severity )
+{
+    assert( ers::Debug <= severity && severity <= ers::Fatal );
+    return SeverityNames[severity];
+}
+
 /** 
  * \brief Transforms a severity type into the corresponding string
  * \param s severity
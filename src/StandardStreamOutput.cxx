@@ -6,11 +6,17 @@
  *  Copyright 2007 CERN. All rights reserved.
  *
  */
-#include <iomanip>
+#include <time.h>
 
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+
+#include <ers/Configuration.h>
 #include <ers/Issue.h>
 #include <ers/StandardStreamOutput.h>
 #include <ers/Severity.h>
+#include <ers/internal/Format.h>
 #include <ers/internal/Util.h>
 
 #include <boost/algorithm/string.hpp>
@@ -19,114 +25,174 @@
 
 namespace
 {    
-    std::function<std::string( const ers::Issue & issue )> getTimeFormatter()
+    void append_padded( std::string & out, long long value, int width, char fill )
     {
-        static std::string format = ers::read_from_environment(
-                    "TDAQ_ERS_TIMESTAMP_FORMAT", "%Y-%b-%d %H:%M:%S");
-
-	static const std::string precision = ers::read_from_environment(
-        	"TDAQ_ERS_TIMESTAMP_PRECISION", "MILLI");
-                        
-        static const bool isUTC = ::getenv("TDAQ_ERS_TIMESTAMP_UTC");
-
-        if ( boost::algorithm::ifind_first(precision, "NANO") ) {
-            return [](const ers::Issue & issue){
-                return issue.time<std::chrono::nanoseconds>(format, isUTC);
-            };
-        }
- 
-        if ( boost::algorithm::ifind_first(precision, "MICRO") ) {
-            return [](const ers::Issue & issue){
-                return issue.time<std::chrono::microseconds>(format, isUTC);
-            };
-        }
-
-        if ( boost::algorithm::ifind_first(precision, "MILLI") ) {
-            return [](const ers::Issue & issue){
-                return issue.time<std::chrono::milliseconds>(format, isUTC);
-            };
-        }
-
-	return [](const ers::Issue & issue) {
-            return issue.time(format, isUTC);
-        };
+	char buff[32];
+	std::to_chars_result r = std::to_chars( buff, buff + sizeof( buff ), value );
+	if ( fill != ' ' )
+	    out.append( std::max( 0, width - int( r.ptr - buff ) ), fill );
+	out.append( buff, r.ptr );
+	if ( fill == ' ' )
+	    out.append( std::max( 0, width - int( r.ptr - buff ) ), fill );
     }
+
+    /** Formats the issue time in the same way as ers::Issue::time does for the configured precision.
+      * The result of strftime is cached per thread, so it is called only once per second.
+      */
+    class TimeFormatter
+    {
+	struct Cache
+	{
+	    std::time_t	m_second = -1;
+	    size_t	m_length = 0;
+	    char	m_text[128 - 16];
+	};
+
+      public:
+	TimeFormatter()
+	  : m_format( ers::read_from_environment( "TDAQ_ERS_TIMESTAMP_FORMAT", "%Y-%b-%d %H:%M:%S" ) ),
+	    m_utc( ::getenv( "TDAQ_ERS_TIMESTAMP_UTC" ) ),
+	    m_width( 0 ),
+	    m_ticks( 1 )
+	{
+	    std::string precision = ers::read_from_environment( "TDAQ_ERS_TIMESTAMP_PRECISION", "MILLI" );
+
+	    if ( boost::algorithm::ifind_first( precision, "NANO" ) ) {
+		m_width = 9;
+	    }
+	    else if ( boost::algorithm::ifind_first( precision, "MICRO" ) ) {
+		m_width = 6;
+	    }
+	    else if ( boost::algorithm::ifind_first( precision, "MILLI" ) ) {
+		m_width = 3;
+	    }
+
+	    for ( int i = 0; i < m_width; ++i )
+		m_ticks *= 10;
+	}
+
+	void append( std::string & out, const system_clock::time_point & time ) const
+	{
+	    thread_local Cache cache;
+
+	    std::time_t t = system_clock::to_time_t( time );
+	    if ( t != cache.m_second )
+	    {
+		std::tm tm;
+		m_utc ? gmtime_r( &t, &tm ) : localtime_r( &t, &tm );
+		cache.m_length = std::strftime( cache.m_text, sizeof( cache.m_text ), m_format.c_str(), &tm );
+		cache.m_second = t;
+	    }
+	    out.append( cache.m_text, cache.m_length );
+
+	    long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>( time.time_since_epoch() ).count();
+	    out.push_back( ',' );
+	    append_padded( out, ns / ( 1000000000 / m_ticks ) - (long long)t * m_ticks, m_width, '0' );
+	}
+
+      private:
+	std::string	m_format;
+	bool		m_utc;
+	int		m_width;
+	long long	m_ticks;
+    };
     
-    const auto formatted_time = getTimeFormatter();
+    const TimeFormatter formatted_time;
 }
 
 std::ostream &
 ers::StandardStreamOutput::println( std::ostream & out, const Issue & issue, int verbosity )
 {
-    print( out, issue, verbosity );
-    out << std::endl;
+    ers::fmt::Buffer buffer;
+    print( buffer.str(), issue, verbosity );
+    buffer.str().push_back( '\n' );
+    out.write( buffer.str().data(), buffer.str().size() );
+    out.flush();
     return out;
 }
 
 std::ostream &
 ers::StandardStreamOutput::print( std::ostream & out, const Issue & issue, int verbosity )
+{
+    ers::fmt::Buffer buffer;
+    print( buffer.str(), issue, verbosity );
+    out.write( buffer.str().data(), buffer.str().size() );
+    return out;
+}
+
+void
+ers::StandardStreamOutput::print( std::string & out, const Issue & issue, int verbosity )
 {
     if ( verbosity > -3 )
     {
-	out << formatted_time( issue ) << " ";
+	formatted_time.append( out, issue.ptime() );
+	out.push_back( ' ' );
     }
 
     if ( verbosity > -2 )
     {
-	out << ers::to_string( issue.severity() ) << " ";
+	ers::Severity severity = issue.severity();
+	out.append( ers::severity_name( severity.type ) );
+	if ( severity.type == ers::Debug )
+	{
+	    out.push_back( '_' );
+	    ers::fmt::append( out, (long long)severity.rank );
+	}
+	out.push_back( ' ' );
     }
 
     if ( verbosity > -1 )
     {
-	out << "[" << issue.context().position( verbosity ) << "] ";
+	out.push_back( '[' );
+	issue.context().position( out, verbosity );
+	out.append( "] " );
     }
 
-    out << issue.message();
+    out.append( issue.message() );
 
     if ( verbosity > 1 )
     {
-	out << FIELD_SEPARATOR << "Parameters = ";
+	out.append( FIELD_SEPARATOR "Parameters = " );
 	for ( ers::string_map::const_iterator it = issue.parameters().begin(); it != issue.parameters().end(); ++it )
 	{
-	    out << "'" << it->first << "=" << it->second << "' ";
+	    out.append( "'" ).append( it->first ).append( "=" ).append( it->second ).append( "' " );
 	}
 
-	out << FIELD_SEPARATOR << "Qualifiers = ";
+	out.append( FIELD_SEPARATOR "Qualifiers = " );
 	for ( std::vector<std::string>::const_iterator it = issue.qualifiers().begin(); it != issue.qualifiers().end(); ++it )
 	{
-	    out << "'" << *it << "' ";
+	    out.append( "'" ).append( *it ).append( "' " );
 	}
     }
 
     if ( verbosity > 2 )
     {
-	out << FIELD_SEPARATOR << "host = " << issue.context().host_name()
-	    << FIELD_SEPARATOR << "user = " << issue.context().user_name()
-			       << " (" << issue.context().user_id() << ")"
-	    << FIELD_SEPARATOR << "process id = " << issue.context().process_id()
-	    << FIELD_SEPARATOR << "thread id = " << issue.context().thread_id()
-	    << FIELD_SEPARATOR << "process wd = " << issue.context().cwd();
+	const Context & context = issue.context();
+	out.append( FIELD_SEPARATOR "host = " ).append( context.host_name() );
+	out.append( FIELD_SEPARATOR "user = " ).append( context.user_name() ).append( " (" );
+	ers::fmt::append( out, (long long)context.user_id() );
+	out.append( ")" FIELD_SEPARATOR "process id = " );
+	ers::fmt::append( out, (long long)context.process_id() );
+	out.append( FIELD_SEPARATOR "thread id = " );
+	ers::fmt::append( out, (long long)context.thread_id() );
+	out.append( FIELD_SEPARATOR "process wd = " ).append( context.cwd() );
     }
 
     if ( verbosity > 3 )
     {
-	std::ios_base::fmtflags flags( out.flags() );
-
-	out << std::left;
         std::vector<std::string> stack = issue.context().stack();
-        out << FIELD_SEPARATOR << "stack trace of the crashing thread:";
+        out.append( FIELD_SEPARATOR "stack trace of the crashing thread:" );
 	for( size_t i = 0; i < stack.size(); i++ )
 	{
-	    out << FIELD_SEPARATOR << "  #" << std::setw(3) << i << stack[i];
+	    out.append( FIELD_SEPARATOR "  #" );
+	    append_padded( out, i, 3, ' ' );
+	    out.append( stack[i] );
 	}
-        // restore the original state
-	out.flags( flags );
     }
 
     if ( issue.cause() )
     {
-	out << FIELD_SEPARATOR << "was caused by: " << *issue.cause();
+	out.append( FIELD_SEPARATOR "was caused by: " );
+	print( out, *issue.cause(), ers::Configuration::instance().verbosity_level() );
     }
-    
-    return out;
 }
@@ -35,6 +35,23 @@ ers::StreamFactory::instance()
     return *instance;
 } // instance
 
+/** Looks up the stream creator with the given name. If the creator is not registered
+  * yet, the library which implements this stream is loaded and the lookup is repeated.
+  * \return the creator or null pointer if it is not found
+  */
+template <class Map>
+typename Map::mapped_type
+ers::StreamFactory::find( const Map & factories, const std::string & name ) const
+{
+    std::scoped_lock lock( m_mutex );
+    typename Map::const_iterator it = factories.find( name );
+    if ( it == factories.end() && m_plugin_manager.load_stream( name ) )
+    {
+	it = factories.find( name );
+    }
+    return it != factories.end() ? it->second : 0;
+}
+
 /** Builds a stream from a textual key 
   * The key should have the format \c stream_name[(stream_parameters)]
   * For some streams parameters can be ommitted. 
@@ -52,18 +69,19 @@ ers::StreamFactory::create_out_stream( const std::string & format ) const
     if ( start != std::string::npos )
     {
 	key = format.substr( 0, start );
-	std::string::size_type end = format.find( ')', start );
-        if ( end != std::string::npos )
+	// the parameters may contain nested streams definitions with their own brackets
+	std::string::size_type end = format.rfind( ')' );
+        if ( end != std::string::npos && end > start )
             param = format.substr( start + 1, end - start - 1 );
     }    	
 
-    OutFunctionMap::const_iterator it = m_out_factories.find( key );
+    OutputStreamCreator creator = find( m_out_factories, key );
     
-    if( it != m_out_factories.end() )
+    if( creator )
     {
 	try
         {
-            return it->second( param );
+            return creator( param );
         }
         catch( ers::Issue & issue )
         {
@@ -78,6 +96,44 @@ ers::StreamFactory::create_out_stream( const std::string & format ) const
     return 0; 
 }
 
+/** Builds a chain of streams, in which each stream passes issues to the next one.
+  * Streams, which can not be created, are skipped.
+  * \param streams stream keys in the format accepted by \c create_out_stream
+  * \return the first stream of the chain or null pointer if none of the streams can be created
+  * \note the streams are allocated on the heap, it is the caller's responsibility to delete the first one.
+  */
+ers::OutputStream *
+ers::StreamFactory::create_out_chain( const std::vector<std::string> & streams ) const
+{    
+    size_t cnt = 0;
+    ers::OutputStream * main = 0;
+    for ( ; cnt < streams.size(); ++cnt )
+    {
+	main = create_out_stream( streams[cnt] );
+        if ( main )
+            break;
+    }
+    
+    if ( !main )
+    {
+    	return 0;
+    }
+    
+    ers::OutputStream * head = main;
+    for ( ++cnt; cnt < streams.size(); ++cnt )
+    {
+	ers::OutputStream * chained = create_out_stream( streams[cnt] );
+       
+	if ( chained )
+	{
+	    head->chained( chained );
+	    head = chained;
+        }
+    }
+        
+    return main;
+}
+
 /** Builds a stream from a textual key 
   * The key should have the format \c stream_name[(stream_parameters)]
   * For some streams parameters can be ommitted. 
@@ -106,13 +162,13 @@ ers::StreamFactory::create_in_stream(
 	const std::string & stream, 
 	const std::initializer_list<std::string> & params ) const
 {
-    InFunctionMap::const_iterator it = m_in_factories.find( stream );
+    InputStreamCreator creator = find( m_in_factories, stream );
     
-    if( it != m_in_factories.end() )
+    if( creator )
     {
 	try
         {
-            return it->second( params );
+            return creator( params );
         }
         catch( ers::Issue & issue )
         {
@@ -136,6 +192,7 @@ ers::StreamFactory::create_in_stream(
 void
 ers::StreamFactory::register_in_stream( const std::string & name, InputStreamCreator callback )
 {
+    std::scoped_lock lock( m_mutex );
     m_in_factories[name] = callback;
 }
 
@@ -152,6 +209,7 @@ ers::StreamFactory::register_in_stream( const std::string & name, InputStreamCre
 void
 ers::StreamFactory::register_out_stream( const std::string & name, OutputStreamCreator callback )
 {
+    std::scoped_lock lock( m_mutex );
     m_out_factories[name] = callback;
 }
 
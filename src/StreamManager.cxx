@@ -21,7 +21,6 @@
 #include <ers/ers.h>
 #include <ers/internal/macro.h>
 #include <ers/internal/Util.h>
-#include <ers/internal/PluginManager.h>
 #include <ers/internal/NullStream.h>
 #include <ers/internal/SingletonCreator.h>
 
@@ -62,38 +61,10 @@ namespace
     parse_stream_definition(	const std::string & text,
 				std::vector<std::string> & result )
     {
-	std::string::size_type start_p = 0, end_p = 0;
-	short brackets_open = 0;
-	while ( end_p < text.length() )
-	{
-	    switch ( text[end_p] )
-	    {
-		case '(':
-		    ++brackets_open;
-		    break;
-		case ')':
-		    --brackets_open;
-		    break;
-		case SEPARATOR:
-		    if ( !brackets_open )
-		    {
-			result.push_back( text.substr( start_p, end_p - start_p ) );
-			start_p = end_p + 1;
-		    }
-                    break;
-		default:
-		    break;
-	    }
-	    end_p++;
-	}
-        if ( brackets_open )
+        if ( !ers::split_nested( text, SEPARATOR, result ) )
         {
             throw ers::BadConfiguration( ERS_HERE, text );
         }
-        if ( start_p != end_p )
-        {
-	    result.push_back( text.substr( start_p, end_p - start_p ) );
-        }
     }
 }
 
@@ -131,9 +102,21 @@ namespace ers
 		m_manager.m_out_streams[s] =
 		    std::shared_ptr<OutputStream>( m_manager.setup_stream( s ) );
 	    }
-	    m_manager.report_issue( s, issue );
+	    // the severity, including the debug level, has already been assigned by the caller
+	    m_manager.m_out_streams[s]->write( issue );
             m_in_progress = false;
 	  }
+
+	  void write_batch( const Issue * const * issues, size_t count )
+	  {
+	    // the first issue sets up the stream, the others are passed to it directly
+	    if ( count )
+	    {
+		write( *issues[0] );
+		if ( count > 1 )
+		    m_manager.m_out_streams[issues[0]->severity().type]->write_batch( issues + 1, count - 1 );
+	    }
+	  }
           
         private:
 	  std::recursive_mutex   m_mutex;
@@ -268,33 +251,7 @@ ers::StreamManager::setup_stream( ers::severity severity )
 ers::OutputStream * 
 ers::StreamManager::setup_stream( const std::vector<std::string> & streams )
 {    
-    size_t cnt = 0;
-    ers::OutputStream * main = 0;
-    for ( ; cnt < streams.size(); ++cnt )
-    {
-	main = ers::StreamFactory::instance().create_out_stream( streams[cnt] );
-        if ( main )
-            break;
-    }
-    
-    if ( !main )
-    {
-    	return 0;
-    }
-    
-    ers::OutputStream * head = main;
-    for ( ++cnt; cnt < streams.size(); ++cnt )
-    {
-	ers::OutputStream * chained = ers::StreamFactory::instance().create_out_stream( streams[cnt] );
-       
-	if ( chained )
-	{
-	    head->chained( chained );
-	    head = chained;
-        }
-    }
-        
-    return main;
+    return ers::StreamFactory::instance().create_out_chain( streams );
 }
 
 /** Sends an Issue to an appropriate stream 
@@ -309,6 +266,34 @@ ers::StreamManager::report_issue( ers::severity type, const Issue & issue )
     issue.set_severity( old_severity );
 } // error
 
+/** Sends several issues to the stream of the given severity with a single call
+ * \param type severity of the stream, which is also assigned to the issues while they are written
+ * \param issues array of pointers to the issues to be sent
+ * \param count number of issues in the array
+ * \param level the debug level, which is used only if the type is ers::Debug. The issues are not sent
+ *	if it is greater than the current debug level.
+ */
+void
+ers::StreamManager::report_batch( ers::severity type, const Issue * const * issues, size_t count, int level )
+{
+    if ( !count || ( type == ers::Debug && Configuration::instance().debug_level() < level ) )
+	return;
+
+    ers::Severity severity( type, type == ers::Debug ? level : 0 );
+    std::vector<ers::Severity> old_severities( count, severity );
+    for ( size_t i = 0; i < count; ++i )
+    {
+	old_severities[i] = issues[i]->set_severity( severity );
+    }
+
+    m_out_streams[type]->write_batch( issues, count );
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+	issues[i]->set_severity( old_severities[i] );
+    }
+}
+
 /** Sends an Issue to the error stream 
  * \param issue 
  */
@@ -0,0 +1,248 @@
+/*
+ *  Symbolizer.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+#include <string.h>
+#include <stdlib.h>
+#include <cxxabi.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+
+#if defined(__linux__)
+#include <elf.h>
+#include <link.h>
+#endif
+
+#ifndef __rtems__
+#include <execinfo.h>
+#else
+char** backtrace_symbols (void ** , int size) {
+    return 0;
+}
+#endif
+
+#include <ers/internal/SingletonCreator.h>
+#include <ers/internal/Symbolizer.h>
+
+namespace
+{
+    std::string
+    demangle( char * mangled )
+    {
+        int status;
+	char * function_begin = ::strchr( mangled, '(' );
+        if ( function_begin ) {
+            char * function_end = ::strchr( ++function_begin, '+' );
+            if ( function_end && function_end != function_begin)
+            {
+                std::string fname(function_begin, function_end - function_begin);
+                char * name = abi::__cxa_demangle( fname.c_str(), 0, 0, &status );
+
+                if (!name) {
+                    return std::string( mangled );
+                }
+
+                std::string result( mangled, function_begin - mangled );
+                result += name;
+                result += function_end;
+                free( name );
+                return result;
+            }
+        }
+	return std::string( mangled );
+    }
+
+#if defined(__linux__)
+    std::string
+    to_hex( const unsigned char * data, size_t size )
+    {
+	static const char digits[] = "0123456789abcdef";
+	std::string result;
+	result.reserve( size * 2 );
+	for ( size_t i = 0; i < size; ++i )
+	{
+	    result.push_back( digits[data[i] >> 4] );
+	    result.push_back( digits[data[i] & 0xf] );
+	}
+	return result;
+    }
+
+    std::string
+    read_build_id( const struct dl_phdr_info * info )
+    {
+	for ( int i = 0; i < info->dlpi_phnum; ++i )
+	{
+	    const ElfW(Phdr) & phdr = info->dlpi_phdr[i];
+	    if ( phdr.p_type != PT_NOTE )
+		continue;
+
+	    const char * note = (const char *)( info->dlpi_addr + phdr.p_vaddr );
+	    const char * end = note + phdr.p_memsz;
+	    while ( note + sizeof( ElfW(Nhdr) ) <= end )
+	    {
+		const ElfW(Nhdr) * header = (const ElfW(Nhdr) *)note;
+		const char * name = note + sizeof( ElfW(Nhdr) );
+		const char * desc = name + ( ( header->n_namesz + 3 ) & ~3 );
+		if (	header->n_type == NT_GNU_BUILD_ID
+		     && header->n_namesz == 4 && !::memcmp( name, "GNU", 4 ) )
+		{
+		    return to_hex( (const unsigned char *)desc, header->n_descsz );
+		}
+		note = desc + ( ( header->n_descsz + 3 ) & ~3 );
+	    }
+	}
+	return std::string();
+    }
+
+    std::string
+    executable_path()
+    {
+	char buf[4096];
+	ssize_t size = ::readlink( "/proc/self/exe", buf, sizeof( buf ) - 1 );
+	return size > 0 ? std::string( buf, size ) : std::string();
+    }
+#endif
+}
+
+std::ostream &
+ers::operator<<( std::ostream & out, const Frame & frame )
+{
+    std::ios_base::fmtflags flags( out.flags() );
+    out << frame.m_module << " [" << frame.m_build_id << "] +0x" << std::hex << frame.m_offset;
+    out.flags( flags );
+    return out;
+}
+
+/** This method returns the singleton instance.
+  * \return a reference to the singleton instance
+  */
+ers::Symbolizer &
+ers::Symbolizer::instance()
+{
+    static ers::Symbolizer * instance = ers::SingletonCreator<ers::Symbolizer>::create();
+
+    return *instance;
+}
+
+const std::string &
+ers::Symbolizer::symbol( void * address )
+{
+    std::scoped_lock lock( m_mutex );
+    auto it = m_symbols.find( address );
+    if ( it != m_symbols.end() )
+    {
+	return it->second;
+    }
+
+    std::string name;
+    char ** symbols = backtrace_symbols( &address, 1 );
+    if ( symbols )
+    {
+	name = demangle( symbols[0] );
+	free( symbols );
+    }
+    return m_symbols.emplace( address, std::move( name ) ).first->second;
+}
+
+ers::Frame
+ers::Symbolizer::frame( void * address )
+{
+    std::scoped_lock lock( m_mutex );
+    const Module * module = lookup_module( (uintptr_t)address );
+    if ( !module )
+    {
+	return Frame{ std::string(), std::string(), (uintptr_t)address };
+    }
+    return Frame{ module->m_path, module->m_build_id, (uintptr_t)address - module->m_base };
+}
+
+const ers::Symbolizer::Module *
+ers::Symbolizer::lookup_module( uintptr_t address )
+{
+    const Module * module = find_module( address );
+    if ( !module && modules_generation() != m_generation )
+    {
+	// a module has been loaded or unloaded after the last scan
+	load_modules();
+	module = find_module( address );
+    }
+    return module;
+}
+
+/** Returns the total number of modules, which have been loaded and unloaded by the process so far.
+  * The numbers are taken from the first module reported by dl_iterate_phdr, so this function is cheap.
+  * The addresses, which do not belong to any module, e.g. the JIT generated code, therefore do not
+  * trigger a rescan of the modules.
+  */
+unsigned long long
+ers::Symbolizer::modules_generation()
+{
+    unsigned long long generation = 0;
+#if defined(__linux__)
+    dl_iterate_phdr(
+	[]( struct dl_phdr_info * info, size_t size, void * data ) -> int
+	{
+	    if ( size >= offsetof( struct dl_phdr_info, dlpi_subs ) + sizeof( info->dlpi_subs ) )
+	    {
+		*static_cast<unsigned long long *>( data ) = info->dlpi_adds + info->dlpi_subs;
+	    }
+	    return 1;
+	}, &generation );
+#endif
+    return generation;
+}
+
+const ers::Symbolizer::Module *
+ers::Symbolizer::find_module( uintptr_t address ) const
+{
+    for ( const Module & module : m_modules )
+    {
+	if ( module.m_begin <= address && address < module.m_end )
+	    return &module;
+    }
+    return 0;
+}
+
+void
+ers::Symbolizer::load_modules()
+{
+    m_modules.clear();
+    m_generation = modules_generation();
+#if defined(__linux__)
+    dl_iterate_phdr(
+	[]( struct dl_phdr_info * info, size_t, void * data ) -> int
+	{
+	    Module module{ UINTPTR_MAX, 0, info->dlpi_addr, info->dlpi_name, read_build_id( info ) };
+	    for ( int i = 0; i < info->dlpi_phnum; ++i )
+	    {
+		const ElfW(Phdr) & phdr = info->dlpi_phdr[i];
+		if ( phdr.p_type == PT_LOAD )
+		{
+		    module.m_begin = std::min( module.m_begin, (uintptr_t)( info->dlpi_addr + phdr.p_vaddr ) );
+		    module.m_end = std::max( module.m_end, (uintptr_t)( info->dlpi_addr + phdr.p_vaddr + phdr.p_memsz ) );
+		}
+	    }
+
+	    std::vector<Module> & modules = *static_cast<std::vector<Module> *>( data );
+	    if ( module.m_path.empty() )
+	    {
+		// the main executable is always reported first with an empty name
+		if ( !modules.empty() )
+		    return 0;
+		module.m_path = executable_path();
+	    }
+	    if ( module.m_begin < module.m_end )
+	    {
+		modules.push_back( std::move( module ) );
+	    }
+	    return 0;
+	}, &m_modules );
+#endif
+}
@@ -23,6 +23,39 @@ ers::tokenize(	const std::string & text,
     while( start_p != std::string::npos );
 }
 
+/** Splits the text at the separators, which are not enclosed in brackets.
+  * \return false if the brackets are not balanced
+  */
+bool
+ers::split_nested(	const std::string & text,
+			char separator,
+			std::vector<std::string> & result )
+{
+    std::string::size_type start_p = 0, end_p = 0;
+    short brackets_open = 0;
+    for ( ; end_p < text.length(); ++end_p )
+    {
+	if ( text[end_p] == '(' )
+	{
+	    ++brackets_open;
+	}
+	else if ( text[end_p] == ')' )
+	{
+	    --brackets_open;
+	}
+	else if ( text[end_p] == separator && !brackets_open )
+	{
+	    result.push_back( text.substr( start_p, end_p - start_p ) );
+	    start_p = end_p + 1;
+	}
+    }
+    if ( start_p != end_p )
+    {
+	result.push_back( text.substr( start_p, end_p - start_p ) );
+    }
+    return !brackets_open;
+}
+
 int
 ers::read_from_environment( const char * name, int default_value )
 {
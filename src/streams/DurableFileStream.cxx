@@ -0,0 +1,169 @@
+/*
+ *  DurableFileStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include <ers/SampleIssues.h>
+#include <ers/StandardStreamOutput.h>
+#include <ers/internal/DurableFileStream.h>
+#include <ers/internal/Util.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::DurableFileStream, "dfile", format )
+
+namespace
+{
+    const char * const SEPARATORS = ",";
+
+#ifdef IOV_MAX
+    const size_t MaxIOVectors = IOV_MAX;
+#else
+    const size_t MaxIOVectors = 1024;
+#endif
+
+    /** Writes all the given buffers to the file, taking care of partially completed writes.
+      */
+    void
+    write_all( int fd, struct iovec * iov, size_t count )
+    {
+	while ( count )
+	{
+	    ssize_t n = ::writev( fd, iov, std::min( count, MaxIOVectors ) );
+	    if ( n < 0 )
+	    {
+		if ( errno == EINTR )
+		    continue;
+		return;
+	    }
+
+	    for ( ; count && (size_t)n >= iov->iov_len; ++iov, --count )
+	    {
+		n -= iov->iov_len;
+	    }
+	    if ( count )
+	    {
+		iov->iov_base = (char*)iov->iov_base + n;
+		iov->iov_len -= n;
+	    }
+	}
+    }
+}
+
+/** Constructor that creates a new instance of the durable file stream with the given configuration.
+  * \param format comma separated list of parameters: file_name[,severity]
+  */
+ers::DurableFileStream::DurableFileStream( const std::string & format )
+  : m_sync_severity( ers::Error ),
+    m_committing( false ),
+    m_enqueued( 0 ),
+    m_committed( 0 )
+{
+    std::vector<std::string> params;
+    ers::tokenize( format, SEPARATORS, params );
+
+    if ( params.size() > 1 )
+    {
+	ers::parse( boost::algorithm::to_upper_copy( params[1] ), m_sync_severity );
+    }
+
+    m_fd = ::open( params[0].c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+    if ( m_fd < 0 )
+    {
+	throw ers::CantOpenFile( ERS_HERE, params[0].c_str() );
+    }
+}
+
+ers::DurableFileStream::~DurableFileStream()
+{
+    std::unique_lock lock( m_mutex );
+    m_condition.wait( lock, [this](){ return !m_committing; } );
+    if ( !m_pending.empty() )
+    {
+	commit( lock );
+    }
+    ::close( m_fd );
+}
+
+/** Writes all the pending records to the file. This function is called with the mutex being
+  * locked by the thread that has found no other commit in progress. It keeps writing until no
+  * more records are pending, which includes the ones enqueued by other threads in the meantime.
+  */
+void
+ers::DurableFileStream::commit( std::unique_lock<std::mutex> & lock )
+{
+    m_committing = true;
+
+    std::vector<Record> batch;
+    std::vector<struct iovec> iov;
+    while ( !m_pending.empty() )
+    {
+	batch.swap( m_pending );
+	uint64_t last = m_enqueued;
+	lock.unlock();
+
+	bool sync = false;
+	iov.resize( batch.size() );
+	for ( size_t i = 0; i < batch.size(); ++i )
+	{
+	    iov[i].iov_base = const_cast<char*>( batch[i].m_data.data() );
+	    iov[i].iov_len = batch[i].m_data.size();
+	    sync |= batch[i].m_sync;
+	}
+
+	write_all( m_fd, iov.data(), iov.size() );
+	if ( sync )
+	{
+	    ::fdatasync( m_fd );
+	}
+	batch.clear();
+
+	lock.lock();
+	m_committed = last;
+	m_condition.notify_all();
+    }
+
+    m_committing = false;
+}
+
+/** Write method
+  * appends the issue to the file. If the issue severity is not lower than the one given
+  * in the stream configuration this function returns only after the issue is synchronized to disk.
+  * \param issue issue to be sent.
+  */
+void
+ers::DurableFileStream::write( const Issue & issue )
+{
+    std::ostringstream out;
+    StandardStreamOutput::println( out, issue, Configuration::instance().verbosity_level() );
+    bool sync = issue.severity().type >= m_sync_severity;
+
+    {
+	std::unique_lock lock( m_mutex );
+	m_pending.push_back( Record{ out.str(), sync } );
+	uint64_t sequence = ++m_enqueued;
+
+	if ( !m_committing )
+	{
+	    commit( lock );
+	}
+	else if ( sync )
+	{
+	    m_condition.wait( lock, [this,sequence](){ return m_committed >= sequence; } );
+	}
+    }
+
+    chained().write( issue );
+}
@@ -0,0 +1,248 @@
+/*
+ *  FileInputStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <future>
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/FileInputStream.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/macro.h>
+
+ERS_REGISTER_INPUT_STREAM( ers::FileInputStream, "file", params )
+
+namespace
+{
+    const size_t MinChunkSize = 1 << 20;
+
+    typedef std::pair<const char *, const char *> Range;
+
+    /** Splits the sequence of records into chunks of similar sizes, which can be decoded independently.
+      * Chunk boundaries are placed at the beginning of records, which are given by the offsets.
+      */
+    std::vector<Range>
+    split( const char * begin, const char * end, const std::vector<const char *> & records )
+    {
+	size_t count = std::max<size_t>( 1, std::min<size_t>(
+	    std::thread::hardware_concurrency(), ( end - begin ) / MinChunkSize ) );
+	size_t step = ( records.size() + count - 1 ) / count;
+
+	std::vector<Range> chunks;
+	for ( size_t i = 0; i < records.size(); i += step )
+	{
+	    chunks.emplace_back( records[i], i + step < records.size() ? records[i + step] : end );
+	}
+	return chunks;
+    }
+}
+
+/** Constructor that maps the file into memory and detects its format.
+  * \param params file_name[,speed]
+  */
+ers::FileInputStream::FileInputStream( const std::initializer_list<std::string> & params )
+  : m_data( 0 ),
+    m_size( 0 ),
+    m_binary( false ),
+    m_speed( 0 ),
+    m_terminated( false )
+{
+    std::vector<std::string> p( params );
+    if ( p.empty() )
+    {
+	throw ers::CantOpenFile( ERS_HERE, "" );
+    }
+
+    if ( p.size() > 1 )
+    {
+	m_speed = std::max( 0., ::atof( p[1].c_str() ) );
+    }
+
+    int fd = ::open( p[0].c_str(), O_RDONLY | O_CLOEXEC );
+    struct stat st;
+    if ( fd < 0 || ::fstat( fd, &st ) < 0 )
+    {
+	if ( fd >= 0 )
+	    ::close( fd );
+	throw ers::CantOpenFile( ERS_HERE, p[0].c_str() );
+    }
+
+    m_size = st.st_size;
+    if ( m_size )
+    {
+	void * data = ::mmap( 0, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	::close( fd );
+	if ( data == MAP_FAILED )
+	{
+	    throw ers::CantOpenFile( ERS_HERE, p[0].c_str() );
+	}
+	m_data = static_cast<const char *>( data );
+	::madvise( data, m_size, MADV_SEQUENTIAL );
+    }
+    else
+    {
+	::close( fd );
+    }
+
+    m_binary = m_size >= codec::BinaryMagicSize
+	&& !::memcmp( m_data, codec::BinaryMagic, codec::BinaryMagicSize );
+}
+
+ers::FileInputStream::~FileInputStream()
+{
+    {
+	std::scoped_lock lock( m_mutex );
+	m_terminated = true;
+    }
+    m_condition.notify_all();
+
+    if ( m_thread.joinable() )
+    {
+	m_thread.join();
+    }
+
+    if ( m_data )
+    {
+	::munmap( const_cast<char *>( m_data ), m_size );
+    }
+}
+
+void
+ers::FileInputStream::start()
+{
+    if ( !m_thread.joinable() )
+    {
+	m_thread = std::thread( &FileInputStream::run, this );
+    }
+}
+
+/** Decodes the whole file using several threads and returns the issues sorted by their time.
+  */
+ers::FileInputStream::Issues
+ers::FileInputStream::decode() const
+{
+    const char * begin = m_data;
+    const char * end = m_data + m_size;
+
+    // Record boundaries are found sequentially, which is cheap compared to decoding
+    std::vector<const char *> records;
+    size_t truncated = 0;
+    if ( m_binary )
+    {
+	begin += codec::BinaryMagicSize;
+	const char * p = begin;
+	for ( size_t size; ( size = codec::binary_frame_size( p, end ) ); p += size )
+	{
+	    records.push_back( p );
+	}
+	// an incomplete frame at the end of the file, e.g. left by a crashed writer
+	truncated = p < end;
+	end = p;
+    }
+    else
+    {
+	for ( const char * p = begin; p < end; )
+	{
+	    records.push_back( p );
+	    const char * eol = static_cast<const char *>( ::memchr( p, '\n', end - p ) );
+	    p = eol ? eol + 1 : end;
+	}
+    }
+
+    bool binary = m_binary;
+    auto decode_chunk = [binary]( Range chunk )
+    {
+	Issues issues;
+	for ( const char * p = chunk.first; p < chunk.second; )
+	{
+	    Issue * issue;
+	    if ( binary )
+	    {
+		issue = codec::decode_binary( p, chunk.second );
+	    }
+	    else
+	    {
+		const char * eol = static_cast<const char *>( ::memchr( p, '\n', chunk.second - p ) );
+		const char * next = eol ? eol + 1 : chunk.second;
+		issue = next - p > 1 ? codec::decode_json( std::string_view( p, next - p ) ) : 0;
+		p = next;
+	    }
+	    if ( issue )
+	    {
+		issues.emplace_back( issue );
+	    }
+	}
+	return issues;
+    };
+
+    std::vector<Range> chunks = split( begin, end, records );
+    std::vector<std::future<Issues> > results;
+    for ( size_t i = 1; i < chunks.size(); ++i )
+    {
+	results.push_back( std::async( std::launch::async, decode_chunk, chunks[i] ) );
+    }
+
+    Issues issues = chunks.empty() ? Issues() : decode_chunk( chunks[0] );
+    for ( auto & r : results )
+    {
+	Issues part = r.get();
+	std::move( part.begin(), part.end(), std::back_inserter( issues ) );
+    }
+
+    size_t skipped = records.size() - issues.size() + truncated;
+    if ( skipped )
+    {
+	ERS_INTERNAL_ERROR( skipped << " malformed records have been skipped" )
+    }
+
+    std::stable_sort( issues.begin(), issues.end(),
+	[]( const std::unique_ptr<Issue> & a, const std::unique_ptr<Issue> & b )
+	{ return a->ptime() < b->ptime(); } );
+
+    return issues;
+}
+
+/** Delivers the decoded issues to the receiver. If the replay speed is not zero the original
+  * intervals between the issues are reproduced, divided by the speed value.
+  */
+void
+ers::FileInputStream::run()
+{
+    Issues issues = decode();
+    if ( issues.empty() )
+	return;
+
+    const auto origin = issues.front()->ptime();
+    const auto started = std::chrono::steady_clock::now();
+
+    for ( const auto & issue : issues )
+    {
+	if ( m_speed > 0 )
+	{
+	    std::chrono::duration<double> offset = issue->ptime() - origin;
+	    auto deadline = started + std::chrono::duration_cast<std::chrono::steady_clock::duration>( offset / m_speed );
+
+	    std::unique_lock lock( m_mutex );
+	    if ( m_condition.wait_until( lock, deadline, [this](){ return m_terminated; } ) )
+		return;
+	}
+	else
+	{
+	    std::scoped_lock lock( m_mutex );
+	    if ( m_terminated )
+		return;
+	}
+
+	receive( *issue );
+    }
+}
@@ -18,3 +18,9 @@ void ers::GlobalLockStream::write( const Issue & issue )
     std::scoped_lock slock( mutex_ );
     chained().write( issue );
 }
+
+void ers::GlobalLockStream::write_batch( const Issue * const * issues, size_t count )
+{
+    std::scoped_lock slock( mutex_ );
+    chained().write_batch( issues, count );
+}
@@ -16,3 +16,9 @@ void ers::LockStream::write( const Issue & issue )
     std::scoped_lock slock( m_mutex );
     chained().write( issue );
 }
+
+void ers::LockStream::write_batch( const Issue * const * issues, size_t count )
+{
+    std::scoped_lock slock( m_mutex );
+    chained().write_batch( issues, count );
+}
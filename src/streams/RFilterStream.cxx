@@ -103,3 +103,24 @@ ers::RFilterStream::write( const ers::Issue & issue )
     }
 } // send
 
+/** Passes the accepted issues to the chained stream as a single batch.
+  */
+void
+ers::RFilterStream::write_batch( const Issue * const * issues, size_t count )
+{
+    std::vector<const Issue *> accepted;
+    accepted.reserve( count );
+    for ( size_t i = 0; i < count; ++i )
+    {
+	if ( is_accepted( *issues[i] ) )
+	{
+	    accepted.push_back( issues[i] );
+	}
+    }
+
+    if ( !accepted.empty() )
+    {
+	chained().write_batch( accepted.data(), accepted.size() );
+    }
+}
+
@@ -0,0 +1,106 @@
+/*
+ *  RecordFileStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/RecordFileStream.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::BinaryFileStream, "bfile", file_name )
+ERS_REGISTER_OUTPUT_STREAM( ers::JsonFileStream, "jfile", file_name )
+
+namespace
+{
+    void
+    write_all( int fd, const char * data, size_t size )
+    {
+	while ( size )
+	{
+	    ssize_t n = ::write( fd, data, size );
+	    if ( n < 0 )
+	    {
+		if ( errno == EINTR )
+		    continue;
+		return;
+	    }
+	    data += n;
+	    size -= n;
+	}
+    }
+}
+
+ers::RecordFileStream::RecordFileStream( const std::string & file_name, Encoder encoder, std::string_view header )
+  : m_encoder( encoder )
+{
+    m_fd = ::open( file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+    if ( m_fd < 0 )
+    {
+	throw ers::CantOpenFile( ERS_HERE, file_name.c_str() );
+    }
+
+    struct stat st;
+    if ( !header.empty() && ::fstat( m_fd, &st ) == 0 && st.st_size == 0 )
+    {
+	write_all( m_fd, header.data(), header.size() );
+    }
+}
+
+ers::RecordFileStream::~RecordFileStream()
+{
+    ::close( m_fd );
+}
+
+/** Write method
+  * encodes the issue and appends the resulting record to the file with a single system call.
+  * \param issue issue to be sent.
+  */
+void
+ers::RecordFileStream::write( const Issue & issue )
+{
+    std::string record;
+    m_encoder( issue, record );
+
+    {
+	std::scoped_lock lock( m_mutex );
+	write_all( m_fd, record.data(), record.size() );
+    }
+
+    chained().write( issue );
+}
+
+/** Encodes all the issues of the batch and appends them to the file with a single system call.
+  */
+void
+ers::RecordFileStream::write_batch( const Issue * const * issues, size_t count )
+{
+    std::string records;
+    for ( size_t i = 0; i < count; ++i )
+    {
+	m_encoder( *issues[i], records );
+    }
+
+    {
+	std::scoped_lock lock( m_mutex );
+	write_all( m_fd, records.data(), records.size() );
+    }
+
+    chained().write_batch( issues, count );
+}
+
+ers::BinaryFileStream::BinaryFileStream( const std::string & file_name )
+  : RecordFileStream( file_name, &codec::encode_binary,
+	std::string_view( codec::BinaryMagic, codec::BinaryMagicSize ) )
+{ ; }
+
+ers::JsonFileStream::JsonFileStream( const std::string & file_name )
+  : RecordFileStream( file_name, &codec::encode_json, std::string_view() )
+{ ; }
@@ -0,0 +1,253 @@
+/*
+ *  RotatingFileStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+#include <ers/SampleIssues.h>
+#include <ers/StandardStreamOutput.h>
+#include <ers/internal/RotatingFileStream.h>
+#include <ers/internal/Util.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::RotatingFileStream, "rfile", format )
+
+namespace
+{
+    const char * const SEPARATORS = ",";
+    const char * const NEXT_SUFFIX = ".next";
+
+    off_t
+    parse_size( const std::string & value, off_t default_value )
+    {
+	char * end = 0;
+	long long size = ::strtoll( value.c_str(), &end, 10 );
+	if ( end == value.c_str() || size <= 0 )
+	{
+	    return default_value;
+	}
+
+	switch ( *end )
+	{
+	    case 'g': case 'G': size <<= 10;	// fall through
+	    case 'm': case 'M': size <<= 10;	// fall through
+	    case 'k': case 'K': size <<= 10;	// fall through
+	    default: break;
+	}
+	return size;
+    }
+
+    int
+    parse_int( const std::string & value, int default_value )
+    {
+	std::istringstream in( value );
+	int result = default_value;
+	in >> result;
+	return in ? result : default_value;
+    }
+}
+
+ers::RotatingFileStream::Segment::Segment( const std::string & name, off_t preallocate )
+  : m_fd( ::open( name.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644 ) ),
+    m_size( 0 ),
+    m_opened( ::time( 0 ) )
+{
+    if ( m_fd < 0 )
+    {
+	throw ers::CantOpenFile( ERS_HERE, name.c_str() );
+    }
+
+    struct stat st;
+    if ( !::fstat( m_fd, &st ) )
+    {
+	m_size = st.st_size;
+    }
+
+#if defined(__linux__)
+    // Allocate disk blocks for the whole segment in advance without changing the
+    // file size, so appending to the file does not have to extend it block by block.
+    // Failure is harmless, e.g. the file system may not support preallocation.
+    if ( preallocate > m_size )
+    {
+	::fallocate( m_fd, FALLOC_FL_KEEP_SIZE, m_size, preallocate - m_size );
+    }
+#endif
+}
+
+ers::RotatingFileStream::Segment::~Segment()
+{
+    // release preallocated blocks, which have not been used
+    if ( ::ftruncate( m_fd, m_size ) ) { ; }
+    ::close( m_fd );
+}
+
+/** Constructor that creates a new instance of the rotating file stream with the given configuration.
+  * \param format comma separated list of parameters: path[,max_size[,max_files[,interval]]]
+  */
+ers::RotatingFileStream::RotatingFileStream( const std::string & format )
+  : m_max_size( 100 << 20 ),
+    m_max_files( 10 ),
+    m_interval( 0 ),
+    m_terminated( false )
+{
+    std::vector<std::string> params;
+    ers::tokenize( format, SEPARATORS, params );
+
+    m_path = params[0];
+    if ( params.size() > 1 )
+	m_max_size = parse_size( params[1], m_max_size );
+    if ( params.size() > 2 )
+	m_max_files = std::max( 1, parse_int( params[2], m_max_files ) );
+    if ( params.size() > 3 )
+	m_interval = std::max( 0, parse_int( params[3], m_interval ) );
+
+    m_active.reset( new Segment( m_path, m_max_size ) );
+    m_thread = std::thread( &ers::RotatingFileStream::thread_wrapper, this );
+}
+
+ers::RotatingFileStream::~RotatingFileStream()
+{
+    {
+	std::scoped_lock lock( m_mutex );
+	m_terminated = true;
+	m_condition.notify_one();
+    }
+    m_thread.join();
+
+    if ( m_next )
+    {
+	m_next.reset();
+	::unlink( ( m_path + NEXT_SUFFIX ).c_str() );
+    }
+}
+
+std::string
+ers::RotatingFileStream::segment_name( int index ) const
+{
+    return index ? m_path + "." + std::to_string( index ) : m_path;
+}
+
+/** Gives the retired segment its final name and shifts the names of the older ones.
+  * This function is executed by the background thread.
+  */
+void
+ers::RotatingFileStream::rotate( std::unique_ptr<Segment> & retired )
+{
+    for ( int i = m_max_files - 1; i > 0; --i )
+    {
+	::rename( segment_name( i - 1 ).c_str(), segment_name( i ).c_str() );
+    }
+    ::rename( ( m_path + NEXT_SUFFIX ).c_str(), m_path.c_str() );
+    retired.reset();
+}
+
+void
+ers::RotatingFileStream::thread_wrapper()
+{
+    std::unique_lock lock( m_mutex );
+    while ( !m_terminated )
+    {
+	if ( !m_retired.empty() )
+	{
+	    std::unique_ptr<Segment> retired( std::move( m_retired.front() ) );
+	    m_retired.pop();
+
+	    lock.unlock();
+	    rotate( retired );
+	    lock.lock();
+	}
+	else if ( !m_next )
+	{
+	    lock.unlock();
+	    std::unique_ptr<Segment> next;
+	    try
+	    {
+		::unlink( ( m_path + NEXT_SUFFIX ).c_str() );
+		next.reset( new Segment( m_path + NEXT_SUFFIX, m_max_size ) );
+	    }
+	    catch( ers::Issue & ex )
+	    {
+		ERS_INTERNAL_ERROR( "Can not prepare the next segment of the \"" << m_path
+			<< "\" file because of the following issue {" << ex << "}" )
+	    }
+	    lock.lock();
+
+	    if ( next )
+		m_next.swap( next );
+	    else
+		m_condition.wait_for( lock, std::chrono::seconds( 1 ) );
+	}
+	else
+	{
+	    m_condition.wait( lock );
+	}
+    }
+
+    // finish renaming of the segments that have been already retired
+    while ( !m_retired.empty() )
+    {
+	rotate( m_retired.front() );
+	m_retired.pop();
+    }
+}
+
+/** Write method
+  * prints the issue to the active file. If the file has exceeded either the size or the age
+  * limit and the next file is ready it is replaced by the next one.
+  * \param issue issue to be sent.
+  */
+void
+ers::RotatingFileStream::write( const Issue & issue )
+{
+    std::ostringstream out;
+    StandardStreamOutput::println( out, issue, Configuration::instance().verbosity_level() );
+    const std::string record = out.str();
+
+    {
+	std::scoped_lock wlock( m_write_mutex );
+
+	if (	m_active->m_size > 0
+	    && (    m_active->m_size + (off_t)record.size() > m_max_size
+		|| ( m_interval && issue.time_t() - m_active->m_opened >= m_interval ) ) )
+	{
+	    std::scoped_lock lock( m_mutex );
+	    if ( m_next )
+	    {
+		m_active.swap( m_next );
+		m_active->m_opened = issue.time_t();
+		m_retired.push( std::move( m_next ) );
+		m_condition.notify_one();
+	    }
+	}
+
+	const char * data = record.data();
+	size_t size = record.size();
+	while ( size )
+	{
+	    ssize_t n = ::write( m_active->m_fd, data, size );
+	    if ( n < 0 )
+	    {
+		if ( errno == EINTR )
+		    continue;
+		break;
+	    }
+	    data += n;
+	    size -= n;
+	    m_active->m_size += n;
+	}
+    }
+
+    chained().write( issue );
+}
@@ -0,0 +1,96 @@
+/*
+ *  SampleStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include <ers/IssueFactory.h>
+#include <ers/internal/SampleStream.h>
+#include <ers/internal/Util.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::SampleStream, "sample", format )
+
+namespace
+{
+    const size_t SourcesTableSize = 4096;
+    const std::time_t WindowLength = 60;
+
+    uint64_t mix( uint64_t x )
+    {
+	// splitmix64 finalizer
+	x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ull;
+	x ^= x >> 27; x *= 0x94d049bb133111ebull;
+	x ^= x >> 31;
+	return x;
+    }
+}
+
+ers::SampleStream::SampleStream( const std::string & format )
+  : m_rate( 1 ),
+    m_per_site( 1 ),
+    m_sources( SourcesTableSize, Source{ 0, 0, -1 } )
+{
+    std::vector<std::string> params;
+    ers::tokenize( format, ",", params );
+
+    if ( params.size() > 0 )
+    {
+	std::istringstream in( params[0] );
+	in >> m_rate;
+    }
+
+    if ( params.size() > 1 )
+    {
+	std::istringstream in( params[1] );
+	in >> m_per_site;
+    }
+
+    m_rate = std::min( std::max( m_rate, 0. ), 1. );
+    m_threshold = m_rate < 1 ? (uint64_t)std::ldexp( m_rate, 64 ) : UINT64_MAX;
+}
+
+/** Write method
+  * passes the issue to the next stream if it is one of the first issues of its source within the current
+  * minute or if the hash of its source and sequence number falls into the configured fraction.
+  * \param issue issue to be sent.
+  */
+void
+ers::SampleStream::write( const Issue & issue )
+{
+    const ers::Context & context = issue.context();
+    uint64_t key = mix( ( ers::IssueFactory::type_id( issue.get_class_name() ) * 31
+			+ ers::IssueFactory::type_id( context.file_name() ) ) * 31 + context.line_number() );
+    std::time_t window = issue.time_t() / WindowLength;
+
+    uint64_t sequence;
+    bool guaranteed;
+    {
+	std::scoped_lock lock( m_mutex );
+	// a source, which replaces another one in the table, starts counting from the beginning
+	Source & source = m_sources[key & ( SourcesTableSize - 1 )];
+	if ( source.m_key != key )
+	{
+	    source = Source{ key, 0, window };
+	}
+	else if ( source.m_window != window )
+	{
+	    source.m_window = window;
+	    source.m_sequence = 0;
+	}
+	sequence = source.m_sequence++;
+	guaranteed = sequence < m_per_site;
+    }
+
+    if ( !guaranteed && mix( key ^ mix( sequence ) ) >= m_threshold )
+	return;
+
+    std::unique_ptr<Issue> sample( issue.clone() );
+    sample->add_parameter( "sample_rate", guaranteed ? 1. : m_rate );
+    chained().write( *sample );
+}
@@ -0,0 +1,118 @@
+/*
+ *  ShmInputStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/ShmInputStream.h>
+#include <ers/internal/macro.h>
+
+ERS_REGISTER_INPUT_STREAM( ers::ShmInputStream, "shm", params )
+
+namespace
+{
+    const std::chrono::microseconds MinPollInterval( 50 );
+    const std::chrono::microseconds MaxPollInterval( 5000 );
+    const std::chrono::seconds ReportInterval( 60 );
+}
+
+/** Constructor that opens the ring and registers this process as its collector.
+  * \param params name[,timeout[,mode]]
+  * \throw ers::BadShmConfiguration if the timeout or the mode is invalid
+  */
+ers::ShmInputStream::ShmInputStream( const std::initializer_list<std::string> & params )
+  : m_timeout( 1000 ),
+    m_terminated( false )
+{
+    std::vector<std::string> p( params );
+    if ( p.size() > 1 )
+    {
+	m_timeout = std::chrono::milliseconds( ShmRing::parse_parameter( p[1] ) );
+    }
+    mode_t mode = p.size() > 2 ? ShmRing::parse_mode( p[2] ) : ShmRing::DefaultMode;
+
+    m_ring.reset( new ShmRing( p.empty() ? std::string() : p[0],
+		ShmRing::DefaultCapacity, ShmRing::DefaultSlotSize, mode ) );
+    if ( !m_ring->attach_collector() )
+    {
+	throw ers::CantOpenFile( ERS_HERE, p[0].c_str() );
+    }
+    m_dropped = m_ring->dropped();
+    m_reclaimed = m_ring->reclaimed();
+}
+
+ers::ShmInputStream::~ShmInputStream()
+{
+    m_terminated = true;
+    if ( m_thread.joinable() )
+    {
+	m_thread.join();
+    }
+    m_ring->detach_collector();
+}
+
+void
+ers::ShmInputStream::start()
+{
+    if ( !m_thread.joinable() )
+    {
+	m_thread = std::thread( &ShmInputStream::run, this );
+    }
+}
+
+/** Reports the issues, which have been dropped by the producers, and the slots, which have been reclaimed,
+  * since the last report. The counters are shared by all the processes using the ring.
+  */
+void
+ers::ShmInputStream::report_losses()
+{
+    uint64_t dropped = m_ring->dropped();
+    uint64_t reclaimed = m_ring->reclaimed();
+    if ( dropped != m_dropped || reclaimed != m_reclaimed )
+    {
+	ERS_INTERNAL_WARNING( "The producers of the \"" << m_ring->name() << "\" shared memory ring have dropped "
+		<< dropped - m_dropped << " issues and " << reclaimed - m_reclaimed
+		<< " slots abandoned by them have been reclaimed since the last report" )
+	m_dropped = dropped;
+	m_reclaimed = reclaimed;
+    }
+}
+
+/** Delivers the records from the ring. When the ring is empty the thread sleeps for exponentially
+  * growing intervals, which are limited by a few milliseconds.
+  */
+void
+ers::ShmInputStream::run()
+{
+    std::string record;
+    std::chrono::microseconds interval = MinPollInterval;
+    auto next_report = std::chrono::steady_clock::now() + ReportInterval;
+    while ( !m_terminated )
+    {
+	if ( std::chrono::steady_clock::now() >= next_report )
+	{
+	    report_losses();
+	    next_report += ReportInterval;
+	}
+
+	if ( !m_ring->pop( record, m_timeout ) )
+	{
+	    std::this_thread::sleep_for( interval );
+	    interval = std::min( interval * 2, MaxPollInterval );
+	    continue;
+	}
+
+	interval = MinPollInterval;
+	const char * data = record.data();
+	std::unique_ptr<Issue> issue( codec::decode_binary( data, data + record.size() ) );
+	if ( issue )
+	{
+	    receive( *issue );
+	}
+    }
+    report_losses();
+}
@@ -0,0 +1,450 @@
+/*
+ *  ShmRing.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <new>
+#include <thread>
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/ShmRing.h>
+
+ERS_DEFINE_ISSUE_CXX(	ers,
+			BadShmConfiguration,
+			"The \"" << parameter << "\" parameter of the shm stream is invalid.",
+			((std::string)parameter) )
+
+namespace
+{
+    const uint64_t Magic = 0x455253524e473032ull;	// "ERSRNG02"
+    const uint64_t Busy = 1ull << 63;
+    const size_t CacheLine = 64;
+    const uint64_t PidBits = 22;			// PID_MAX_LIMIT of Linux
+    const uint64_t PidMask = ( 1ull << PidBits ) - 1;
+
+    static_assert( std::atomic<uint64_t>::is_always_lock_free, "shared memory ring requires lock-free atomics" );
+
+    enum ProcessState { Running, Terminated, Unknown };
+
+    /** Reads the state and the start time, in clock ticks after the system boot, of the given process
+      * from the fields 3 and 22 of the /proc/<pid>/stat file. It does not allocate memory, so it can be
+      * used on the hot path.
+      */
+    ProcessState process_state( pid_t pid, uint64_t & start )
+    {
+	char buf[512];
+	::snprintf( buf, sizeof( buf ), "/proc/%d/stat", (int)pid );
+	int fd = ::open( buf, O_RDONLY | O_CLOEXEC );
+	ssize_t size = -1;
+	if ( fd >= 0 )
+	{
+	    size = ::read( fd, buf, sizeof( buf ) - 1 );
+	    ::close( fd );
+	}
+	if ( size <= 0 )
+	{
+	    // /proc might not be mounted, a missing pid proves the termination in any case
+	    return ::kill( pid, 0 ) && errno == ESRCH ? Terminated : Unknown;
+	}
+
+	// the command name in the field 2 may contain spaces and parentheses
+	buf[size] = 0;
+	char * field = ::strrchr( buf, ')' );
+	if ( !field || field[1] != ' ' )
+	    return Unknown;
+
+	field += 2;
+	if ( *field == 'Z' || *field == 'X' || *field == 'x' )
+	    return Terminated;
+
+	for ( int i = 3; i < 22 && field; ++i )
+	{
+	    field = ::strchr( field, ' ' );
+	    field = field ? field + 1 : 0;
+	}
+	if ( !field )
+	    return Unknown;
+
+	start = ::strtoull( field, 0, 10 );
+	return Running;
+    }
+
+    /** Returns the identity of the calling process, which combines its pid with its start time. It is
+      * recomputed after fork. The start time is 0 if it can not be read, in which case the reuse of
+      * the pid by another process can not be detected.
+      */
+    uint64_t self_identity()
+    {
+	static std::atomic<uint64_t> identity( 0 );
+
+	pid_t pid = ::getpid();
+	uint64_t id = identity.load( std::memory_order_relaxed );
+	if ( ( id & PidMask ) != (uint64_t)pid )
+	{
+	    uint64_t start = 0;
+	    process_state( pid, start );
+	    id = ( start << PidBits ) | pid;
+	    identity.store( id, std::memory_order_relaxed );
+	}
+	return id;
+    }
+
+    /** Checks if the process with the given identity is provably terminated, i.e. no process with its pid
+      * exists, it is a zombie or the pid has been reused by a process started at a different time.
+      */
+    bool is_terminated( uint64_t identity )
+    {
+	if ( !identity )
+	    return false;
+
+	uint64_t start = 0;
+	switch ( process_state( identity & PidMask, start ) )
+	{
+	    case Terminated:
+		return true;
+	    case Running:
+		return ( identity >> PidBits ) && ( identity >> PidBits ) != start;
+	    default:
+		return false;
+	}
+    }
+}
+
+struct ers::ShmRing::Header
+{
+    std::atomic<uint64_t>	m_magic;
+    uint32_t			m_capacity;
+    uint32_t			m_slot_size;
+    std::atomic<uint64_t>	m_collector;		/**< \brief identity of the collector process */
+    std::atomic<uint64_t>	m_dropped;
+    std::atomic<uint64_t>	m_reclaimed;
+    alignas(CacheLine) std::atomic<uint64_t>	m_enqueue;
+    alignas(CacheLine) std::atomic<uint64_t>	m_dequeue;
+};
+
+struct ers::ShmRing::Slot
+{
+    std::atomic<uint64_t>	m_sequence;
+    std::atomic<uint64_t>	m_owner;		/**< \brief identity of the producer process */
+    uint32_t			m_size;
+
+    char * data()
+    { return reinterpret_cast<char *>( this + 1 ); }
+};
+
+/** The segment is created with the O_EXCL flag, so only one process initializes it. Other processes
+  * wait until the header becomes valid and take the geometry from it.
+  */
+ers::ShmRing::ShmRing( const std::string & name, size_t capacity, size_t slot_size, mode_t mode )
+  : m_name( name.empty() || name[0] != '/' ? '/' + name : name ),
+    m_header( 0 ),
+    m_size( 0 ),
+    m_stalled_position( -1 )
+{
+    size_t c = 1;
+    while ( c < capacity )
+	c <<= 1;
+    capacity = c;
+    slot_size = ( std::max( slot_size, sizeof( Slot ) + 64 ) + CacheLine - 1 ) & ~( CacheLine - 1 );
+
+    int fd = ::shm_open( m_name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, mode );
+    if ( fd >= 0 )
+    {
+	m_size = sizeof( Header ) + capacity * slot_size;
+	if ( ::ftruncate( fd, m_size ) == 0 )
+	{
+	    void * address = ::mmap( 0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+	    if ( address != MAP_FAILED )
+	    {
+		m_header = new( address ) Header();
+		m_header->m_capacity = capacity;
+		m_header->m_slot_size = slot_size;
+		for ( uint64_t i = 0; i < capacity; ++i )
+		{
+		    new( &slot( i ) ) Slot();
+		    slot( i ).m_sequence.store( i, std::memory_order_relaxed );
+		}
+		m_header->m_magic.store( Magic, std::memory_order_release );
+	    }
+	}
+	if ( !m_header )
+	{
+	    ::shm_unlink( m_name.c_str() );
+	}
+    }
+    else if ( errno == EEXIST && ( fd = ::shm_open( m_name.c_str(), O_RDWR | O_CLOEXEC, 0 ) ) >= 0 )
+    {
+	// the creator may still be initializing the segment
+	struct stat st;
+	for ( int i = 0; i < 1000 && !m_header; ++i )
+	{
+	    if ( ::fstat( fd, &st ) == 0 && (size_t)st.st_size >= sizeof( Header ) )
+	    {
+		void * address = ::mmap( 0, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+		if ( address == MAP_FAILED )
+		    break;
+
+		Header * header = static_cast<Header *>( address );
+		if ( header->m_magic.load( std::memory_order_acquire ) == Magic
+		    && (size_t)st.st_size >= sizeof( Header ) + (size_t)header->m_capacity * header->m_slot_size )
+		{
+		    m_header = header;
+		    m_size = st.st_size;
+		    break;
+		}
+		::munmap( address, st.st_size );
+	    }
+	    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+	}
+    }
+
+    if ( fd >= 0 )
+    {
+	::close( fd );
+    }
+
+    if ( !m_header )
+    {
+	throw ers::CantOpenFile( ERS_HERE, m_name.c_str() );
+    }
+}
+
+ers::ShmRing::~ShmRing()
+{
+    ::munmap( m_header, m_size );
+}
+
+ers::ShmRing::Slot &
+ers::ShmRing::slot( uint64_t position ) const
+{
+    char * slots = reinterpret_cast<char *>( m_header + 1 );
+    return *reinterpret_cast<Slot *>( slots + ( position & ( m_header->m_capacity - 1 ) ) * m_header->m_slot_size );
+}
+
+size_t
+ers::ShmRing::max_record_size() const
+{
+    return m_header->m_slot_size - sizeof( Slot );
+}
+
+uint64_t
+ers::ShmRing::dropped() const
+{
+    return m_header->m_dropped.load( std::memory_order_relaxed );
+}
+
+uint64_t
+ers::ShmRing::reclaimed() const
+{
+    return m_header->m_reclaimed.load( std::memory_order_relaxed );
+}
+
+size_t
+ers::ShmRing::parse_parameter( const std::string & value )
+{
+    size_t result = 0;
+    const char * end = value.data() + value.size();
+    std::from_chars_result r = std::from_chars( value.data(), end, result );
+    if ( value.empty() || r.ec != std::errc() || r.ptr != end )
+    {
+	throw ers::BadShmConfiguration( ERS_HERE, value );
+    }
+    return result;
+}
+
+mode_t
+ers::ShmRing::parse_mode( const std::string & value )
+{
+    unsigned int result = 0;
+    const char * end = value.data() + value.size();
+    std::from_chars_result r = std::from_chars( value.data(), end, result, 8 );
+    if ( value.empty() || r.ec != std::errc() || r.ptr != end || result > 0777 )
+    {
+	throw ers::BadShmConfiguration( ERS_HERE, value );
+    }
+    return result;
+}
+
+bool
+ers::ShmRing::push( const char * data, size_t size )
+{
+    if ( size > max_record_size() )
+    {
+	m_header->m_dropped.fetch_add( 1, std::memory_order_relaxed );
+	return false;
+    }
+
+    Slot * s;
+    uint64_t position = m_header->m_enqueue.load( std::memory_order_relaxed );
+    while ( true )
+    {
+	s = &slot( position );
+	uint64_t sequence = s->m_sequence.load( std::memory_order_acquire );
+	if ( sequence == position )
+	{
+	    if ( m_header->m_enqueue.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+		break;
+	}
+	else if ( (int64_t)( ( sequence & ~Busy ) - position ) < 0 )
+	{
+	    // the slot still holds a record of the previous round, the ring is full
+	    m_header->m_dropped.fetch_add( 1, std::memory_order_relaxed );
+	    return false;
+	}
+	else
+	{
+	    // another producer has already claimed this position
+	    position = m_header->m_enqueue.load( std::memory_order_relaxed );
+	}
+    }
+
+    // the owner is stored before the slot is marked busy, so the collector can always check whether
+    // the producer of a busy slot is still running
+    uint64_t self = self_identity();
+    uint64_t owner = 0;
+    if ( !s->m_owner.compare_exchange_strong( owner, self, std::memory_order_acq_rel ) )
+    {
+	// a stalled producer of a previous round has not released the slot yet
+	m_header->m_dropped.fetch_add( 1, std::memory_order_relaxed );
+	return false;
+    }
+
+    // the slot may have been reclaimed by the collector if this thread has been stalled for too long
+    uint64_t expected = position;
+    if ( !s->m_sequence.compare_exchange_strong( expected, position | Busy, std::memory_order_acq_rel ) )
+    {
+	s->m_owner.compare_exchange_strong( self, 0, std::memory_order_release );
+	m_header->m_dropped.fetch_add( 1, std::memory_order_relaxed );
+	return false;
+    }
+
+    ::memcpy( s->data(), data, size );
+    s->m_size = size;
+    expected = position | Busy;
+    if ( !s->m_sequence.compare_exchange_strong( expected, position + 1, std::memory_order_acq_rel ) )
+    {
+	m_header->m_dropped.fetch_add( 1, std::memory_order_relaxed );
+	return false;
+    }
+    return true;
+}
+
+/** Makes the slot available for the next round of producers, skipping the record it contains.
+  * The owner of the slot, which has been read before, is released only if it has terminated,
+  * otherwise it releases the slot itself when it finds out that the slot has been reclaimed.
+  */
+bool
+ers::ShmRing::reclaim( Slot & s, uint64_t sequence, uint64_t position, uint64_t owner )
+{
+    if ( !s.m_sequence.compare_exchange_strong( sequence, position + m_header->m_capacity, std::memory_order_acq_rel ) )
+	return false;
+
+    if ( is_terminated( owner ) )
+    {
+	s.m_owner.compare_exchange_strong( owner, 0, std::memory_order_release );
+    }
+    m_header->m_dequeue.store( position + 1, std::memory_order_release );
+    m_header->m_reclaimed.fetch_add( 1, std::memory_order_relaxed );
+    return true;
+}
+
+/** The slot is released before the dequeue position is advanced, so a collector, which dies in between,
+  * leaves the position of an already released slot behind. The next collector detects it by the slot
+  * sequence, which belongs to a later round, and skips it.
+  */
+bool
+ers::ShmRing::pop( std::string & record, std::chrono::steady_clock::duration timeout )
+{
+    while ( true )
+    {
+	uint64_t position = m_header->m_dequeue.load( std::memory_order_relaxed );
+	Slot & s = slot( position );
+	uint64_t sequence = s.m_sequence.load( std::memory_order_acquire );
+
+	if ( sequence == position + 1 )
+	{
+	    record.assign( s.data(), std::min<size_t>( s.m_size, max_record_size() ) );
+	    s.m_owner.store( 0, std::memory_order_relaxed );
+	    s.m_sequence.store( position + m_header->m_capacity, std::memory_order_release );
+	    m_header->m_dequeue.store( position + 1, std::memory_order_release );
+	    return true;
+	}
+
+	if ( (int64_t)( ( sequence & ~Busy ) - position ) >= (int64_t)m_header->m_capacity )
+	{
+	    // the slot has been released by a previous collector, which died before advancing the position
+	    m_header->m_dequeue.store( position + 1, std::memory_order_release );
+	    continue;
+	}
+
+	if ( position >= m_header->m_enqueue.load( std::memory_order_acquire ) )
+	    return false;
+
+	uint64_t owner = s.m_owner.load( std::memory_order_acquire );
+	if ( sequence == ( position | Busy ) )
+	{
+	    // the owner is writing the record: a stalled producer could overwrite the record of the next
+	    // round if the slot were reclaimed, so it is done only if the owner has provably terminated
+	    if ( !is_terminated( owner ) || !reclaim( s, sequence, position, owner ) )
+		return false;
+	}
+	else if ( sequence == position )
+	{
+	    // the slot is claimed but nothing has been written yet, since the producer would have marked it
+	    // busy before, and it can not be marked any more once the slot has been reclaimed
+	    auto now = std::chrono::steady_clock::now();
+	    if ( m_stalled_position != position )
+	    {
+		m_stalled_position = position;
+		m_stalled_since = now;
+		return false;
+	    }
+	    if ( now - m_stalled_since < timeout || !reclaim( s, sequence, position, owner ) )
+		return false;
+	}
+	else
+	{
+	    return false;
+	}
+    }
+}
+
+bool
+ers::ShmRing::attach_collector()
+{
+    uint64_t self = self_identity();
+    uint64_t current = m_header->m_collector.load();
+    do
+    {
+	if ( current == self )
+	    return true;
+	if ( current && !is_terminated( current ) )
+	    return false;
+    }
+    while ( !m_header->m_collector.compare_exchange_weak( current, self ) );
+
+    m_stalled_position = -1;
+    return true;
+}
+
+void
+ers::ShmRing::detach_collector()
+{
+    uint64_t self = self_identity();
+    m_header->m_collector.compare_exchange_strong( self, 0 );
+}
@@ -0,0 +1,62 @@
+/*
+ *  ShmStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/ShmStream.h>
+#include <ers/internal/Util.h>
+#include <ers/internal/macro.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::ShmStream, "shm", format )
+
+namespace
+{
+    const char * const SEPARATORS = ",";
+}
+
+/** Constructor that opens or creates the shared memory ring.
+  * \param format comma separated list of parameters: name[,slots[,slot_size[,mode]]]
+  * \throw ers::BadShmConfiguration if a numeric parameter is invalid
+  */
+ers::ShmStream::ShmStream( const std::string & format )
+  : m_dropped( 0 )
+{
+    std::vector<std::string> params;
+    ers::tokenize( format, SEPARATORS, params );
+
+    size_t capacity = params.size() > 1 ? ShmRing::parse_parameter( params[1] ) : ShmRing::DefaultCapacity;
+    size_t slot_size = params.size() > 2 ? ShmRing::parse_parameter( params[2] ) : ShmRing::DefaultSlotSize;
+    mode_t mode = params.size() > 3 ? ShmRing::parse_mode( params[3] ) : ShmRing::DefaultMode;
+    m_ring.reset( new ShmRing( params.empty() ? std::string() : params[0], capacity, slot_size, mode ) );
+}
+
+ers::ShmStream::~ShmStream()
+{
+    if ( uint64_t dropped = m_dropped.load( std::memory_order_relaxed ) )
+    {
+	ERS_INTERNAL_WARNING( dropped << " issues could not be written into the \""
+		<< m_ring->name() << "\" shared memory ring and have been dropped" )
+    }
+}
+
+/** Write method
+  * encodes the issue into a thread local buffer and copies it into a free slot of the ring.
+  * \param issue issue to be sent.
+  */
+void
+ers::ShmStream::write( const Issue & issue )
+{
+    thread_local std::string frame;
+    frame.clear();
+    codec::encode_binary( issue, frame );
+    if ( !m_ring->push( frame.data(), frame.size() ) )
+    {
+	m_dropped.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    chained().write( issue );
+}
@@ -0,0 +1,225 @@
+/*
+ *  TeeStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <string.h>
+
+#include <charconv>
+
+#include <boost/algorithm/string.hpp>
+
+#include <ers/StreamFactory.h>
+#include <ers/internal/TeeStream.h>
+#include <ers/internal/Util.h>
+
+ERS_DECLARE_ISSUE(	ers,
+			BadTeeConfiguration,
+			"The \"" << branch << "\" branch of the tee stream is invalid.",
+			((std::string)branch) )
+
+ERS_REGISTER_OUTPUT_STREAM( ers::TeeStream, "tee", format )
+
+namespace
+{
+    const size_t DefaultCapacity = 1024;
+    const char * const QueueKey = "queue(";
+}
+
+ers::TeeStream::Branch::Branch( OutputStream * head, size_t capacity, Policy policy )
+  : m_head( head ),
+    m_capacity( std::max<size_t>( capacity, 1 ) ),
+    m_policy( policy ),
+    m_terminated( false ),
+    m_statistics{ 0, 0, 0 },
+    m_processed( 0 ),
+    m_thread( &Branch::run, this )
+{ ; }
+
+/** The issues, which are still queued, are written before the branch thread exits.
+  */
+ers::TeeStream::Branch::~Branch()
+{
+    {
+	std::scoped_lock lock( m_mutex );
+	m_terminated = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+void
+ers::TeeStream::Branch::push( const std::shared_ptr<const Issue> & issue, bool wait )
+{
+    std::unique_lock lock( m_mutex );
+    if ( m_queue.size() >= m_capacity )
+    {
+	if ( m_policy == Block || wait )
+	{
+	    m_condition.wait( lock, [this](){ return m_queue.size() < m_capacity; } );
+	}
+	else if ( m_policy == DropOld )
+	{
+	    m_queue.pop_front();
+	    ++m_statistics.m_dropped;
+	    ++m_processed;
+	}
+	else
+	{
+	    ++m_statistics.m_dropped;
+	    return;
+	}
+    }
+
+    m_queue.push_back( issue );
+    uint64_t sequence = ++m_statistics.m_enqueued;
+    m_condition.notify_all();
+
+    if ( wait )
+    {
+	m_condition.wait( lock, [this,sequence](){ return m_processed >= sequence; } );
+    }
+}
+
+/** Takes all the queued issues at once and passes them to the branch streams as a single batch.
+  */
+void
+ers::TeeStream::Branch::run()
+{
+    std::deque<std::shared_ptr<const Issue> > batch;
+    std::vector<const Issue *> issues;
+
+    std::unique_lock lock( m_mutex );
+    while ( true )
+    {
+	m_condition.wait( lock, [this](){ return !m_queue.empty() || m_terminated; } );
+	if ( m_queue.empty() )
+	    break;
+
+	batch.swap( m_queue );
+	m_condition.notify_all();
+	lock.unlock();
+
+	issues.clear();
+	for ( const auto & issue : batch )
+	    issues.push_back( issue.get() );
+
+	try
+	{
+	    m_head->write_batch( issues.data(), issues.size() );
+	}
+	catch( std::exception & ex )
+	{
+	    // there is nobody to catch exceptions thrown by the branch streams
+	    ERS_INTERNAL_ERROR( "Tee stream branch has failed to write issues: " << ex.what() )
+	}
+	catch( ... )
+	{
+	    ERS_INTERNAL_ERROR( "Tee stream branch has failed to write issues: unknown exception" )
+	}
+	batch.clear();
+
+	lock.lock();
+	m_statistics.m_written += issues.size();
+	m_processed += issues.size();
+	m_condition.notify_all();
+    }
+}
+
+/** Constructor that creates the branches of the tee stream.
+  * \param format stream chains separated by the '|' character
+  */
+ers::TeeStream::TeeStream( const std::string & format )
+{
+    std::vector<std::string> branches;
+    ers::split_nested( format, '|', branches );
+
+    for ( std::string & b : branches )
+    {
+	boost::algorithm::trim( b );
+	std::vector<std::string> streams;
+	if ( !ers::split_nested( b, ',', streams ) || streams.empty() )
+	{
+	    throw ers::BadTeeConfiguration( ERS_HERE, b );
+	}
+
+	size_t capacity = DefaultCapacity;
+	Policy policy = DropNew;
+	if ( boost::algorithm::starts_with( streams[0], QueueKey ) )
+	{
+	    std::string params = streams[0].substr( strlen( QueueKey ), streams[0].rfind( ')' ) - strlen( QueueKey ) );
+	    std::vector<std::string> tokens;
+	    ers::tokenize( params, ",", tokens );
+	    std::string value = tokens.empty() ? std::string() : boost::algorithm::trim_copy( tokens[0] );
+	    std::from_chars_result r = std::from_chars( value.data(), value.data() + value.size(), capacity );
+	    if ( r.ec != std::errc() || r.ptr != value.data() + value.size() || !capacity )
+		throw ers::BadTeeConfiguration( ERS_HERE, b );
+	    std::string name = tokens.size() > 1 ? boost::algorithm::trim_copy( tokens[1] ) : std::string( "drop_new" );
+	    if ( name == "drop_old" )
+		policy = DropOld;
+	    else if ( name == "block" )
+		policy = Block;
+	    else if ( name != "drop_new" )
+		throw ers::BadTeeConfiguration( ERS_HERE, b );
+	    streams.erase( streams.begin() );
+	}
+
+	for ( std::string & s : streams )
+	    boost::algorithm::trim( s );
+
+	OutputStream * head = StreamFactory::instance().create_out_chain( streams );
+	if ( !head )
+	{
+	    throw ers::BadTeeConfiguration( ERS_HERE, b );
+	}
+	m_branches.emplace_back( new Branch( head, capacity, policy ) );
+    }
+}
+
+/** The branch threads are still running, so the statistics are read under the branch locks.
+  * The drop counters are final, since no issues are written to a stream being destroyed.
+  */
+ers::TeeStream::~TeeStream()
+{
+    for ( size_t i = 0; i < m_branches.size(); ++i )
+    {
+	Statistics s = statistics( i );
+	if ( s.m_dropped )
+	{
+	    ERS_INTERNAL_WARNING( "Tee stream branch has dropped " << s.m_dropped << " out of "
+		    << s.m_enqueued + s.m_dropped << " issues" )
+	}
+    }
+}
+
+ers::TeeStream::Statistics
+ers::TeeStream::statistics( size_t branch ) const
+{
+    const Branch & b = *m_branches.at( branch );
+    std::scoped_lock lock( b.m_mutex );
+    return b.m_statistics;
+}
+
+/** Write method
+  * puts a copy of the issue to the queue of every branch and passes the issue to the chained stream.
+  * \param issue issue to be sent.
+  */
+void
+ers::TeeStream::write( const Issue & issue )
+{
+    if ( !m_branches.empty() )
+    {
+	// all the branches share the same copy, which is not modified by them
+	std::shared_ptr<const Issue> copy( issue.clone() );
+	bool wait = issue.severity() == ers::Fatal;
+	for ( const auto & b : m_branches )
+	{
+	    b->push( copy, wait );
+	}
+    }
+
+    chained().write( issue );
+}
@@ -38,6 +38,8 @@ ers::ThrottleStream::reportSuppression(IssueRecord& record, const ers::Issue& is
     msgStream << " -- " << record.m_suppressedCounter << " similar messages suppressed, last occurrence was at "
 		<< record.m_lastOccuranceFormatted;
     
+    flush();
+
     ers::Issue* suppressedNotice = issue.clone();
     suppressedNotice->wrap_message( "",  msgStream.str());
 
@@ -49,6 +51,26 @@ ers::ThrottleStream::reportSuppression(IssueRecord& record, const ers::Issue& is
     record.m_suppressedCounter = 0;
 }
 
+void 
+ers::ThrottleStream::pass(const ers::Issue& issue)
+{
+    if (m_batch) {
+	m_batch->push_back(&issue);
+    }
+    else {
+	chained().write(issue);
+    }
+}
+
+void 
+ers::ThrottleStream::flush()
+{
+    if (m_batch && !m_batch->empty()) {
+	chained().write_batch(m_batch->data(), m_batch->size());
+	m_batch->clear();
+    }
+}
+
 void 
 ers::ThrottleStream::throttle(IssueRecord& rec, const ers::Issue& issue)
 {
@@ -66,7 +88,7 @@ ers::ThrottleStream::throttle(IssueRecord& rec, const ers::Issue& issue)
 	rec.m_initialCounter++;
 	rec.m_lastReport=issueTime;
 	if (!reported) {
-	    chained().write(issue);
+	    pass(issue);
 	}
     }
     else if (rec.m_suppressedCounter>=rec.m_threshold) {
@@ -85,6 +107,7 @@ ers::ThrottleStream::throttle(IssueRecord& rec, const ers::Issue& issue)
 }
 
 ers::ThrottleStream::ThrottleStream( const std::string & criteria )
+  : m_batch( 0 )
 {
     m_initialThreshold = 30;
     m_timeLimit = 30;
@@ -120,3 +143,29 @@ ers::ThrottleStream::write( const ers::Issue & issue )
     std::scoped_lock ml(m_mutex);
     throttle( m_issueMap[issueId], issue );
 }
+
+/** Throttles all the issues of the batch while holding the lock once. The accepted issues
+  * are passed to the chained stream as a batch.
+  */
+void 
+ers::ThrottleStream::write_batch( const ers::Issue * const * issues, size_t count )
+{
+    std::scoped_lock ml(m_mutex);
+    std::vector<const ers::Issue *> batch;
+    batch.reserve( count );
+    m_batch = &batch;
+
+    // the chained streams may throw, e.g. the "throw" one
+    struct Reset {
+	std::vector<const ers::Issue *> *& m_batch;
+	~Reset() { m_batch = 0; }
+    } reset{ m_batch };
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+	const ers::Context& context = issues[i]->context();
+	std::string issueId = context.file_name() + boost::lexical_cast<std::string>(context.line_number());
+	throttle( m_issueMap[issueId], *issues[i] );
+    }
+    flush();
+}
@@ -0,0 +1,196 @@
+/*
+ *  TopKStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include <ers/IssueFactory.h>
+#include <ers/internal/TopKStream.h>
+#include <ers/internal/Util.h>
+
+ERS_DECLARE_ISSUE(	ers,
+			TopSources,
+			"Top " << count << " issue sources within the last " << interval << " seconds: " << sources,
+			((size_t)count)
+			((unsigned int)interval)
+			((std::string)sources) )
+
+ERS_REGISTER_OUTPUT_STREAM( ers::TopKStream, "topk", format )
+
+namespace
+{
+    const size_t CountersPerSource = 8;
+    const size_t MinCounters = 64;
+}
+
+ers::TopKStream::TopKStream( const std::string & format )
+  : m_k( 10 ),
+    m_interval( 60 ),
+    m_start( 0 )
+{
+    std::vector<std::string> params;
+    ers::tokenize( format, ",", params );
+
+    if ( params.size() > 0 )
+    {
+	std::istringstream in( params[0] );
+	in >> m_k;
+    }
+
+    if ( params.size() > 1 )
+    {
+	std::istringstream in( params[1] );
+	in >> m_interval;
+    }
+
+    m_k = std::max<size_t>( m_k, 1 );
+    m_interval = std::max( m_interval, 1u );
+    m_capacity = std::max( m_k * CountersPerSource, MinCounters );
+    m_heap.reserve( m_capacity );
+    m_index.reserve( 2 * m_capacity );
+}
+
+void
+ers::TopKStream::swap( size_t a, size_t b )
+{
+    std::swap( m_heap[a], m_heap[b] );
+    m_index[m_heap[a].m_key] = a;
+    m_index[m_heap[b].m_key] = b;
+}
+
+void
+ers::TopKStream::sift_down( size_t position )
+{
+    while ( true )
+    {
+	size_t smallest = position;
+	for ( size_t child = 2 * position + 1; child <= 2 * position + 2 && child < m_heap.size(); ++child )
+	{
+	    if ( m_heap[child].m_count < m_heap[smallest].m_count )
+		smallest = child;
+	}
+	if ( smallest == position )
+	    return;
+	swap( position, smallest );
+	position = smallest;
+    }
+}
+
+void
+ers::TopKStream::sift_up( size_t position )
+{
+    for ( size_t parent; position && m_heap[position].m_count < m_heap[parent = ( position - 1 ) / 2].m_count; )
+    {
+	swap( position, parent );
+	position = parent;
+    }
+}
+
+/** Increments the counter of the given source. If the source is not monitored and all the counters
+  * are in use, the counter with the smallest value is given to this source, which inherits its value.
+  */
+void
+ers::TopKStream::count( uint64_t key, const Issue & issue )
+{
+    auto it = m_index.find( key );
+    if ( it != m_index.end() )
+    {
+	++m_heap[it->second].m_count;
+	sift_down( it->second );
+	return;
+    }
+
+    std::ostringstream source;
+    source << issue.get_class_name() << " at " << issue.context().file_name() << ":" << issue.context().line_number();
+
+    if ( m_heap.size() < m_capacity )
+    {
+	m_heap.push_back( Counter{ key, 1, 0, source.str() } );
+	m_index[key] = m_heap.size() - 1;
+	sift_up( m_heap.size() - 1 );
+	return;
+    }
+
+    Counter & min = m_heap.front();
+    m_index.erase( min.m_key );
+    min.m_key = key;
+    min.m_error = min.m_count;
+    ++min.m_count;
+    min.m_source = source.str();
+    m_index[key] = 0;
+    sift_down( 0 );
+}
+
+/** Builds the summary of the finished interval and resets all the counters. This function must be called
+  * with the mutex being locked, the summary is passed to the next stream after the mutex is released.
+  */
+std::unique_ptr<ers::Issue>
+ers::TopKStream::report( const Issue & issue, unsigned int elapsed )
+{
+    std::vector<const Counter *> top;
+    for ( const Counter & c : m_heap )
+	top.push_back( &c );
+
+    size_t count = std::min( m_k, top.size() );
+    std::partial_sort( top.begin(), top.begin() + count, top.end(),
+	[]( const Counter * a, const Counter * b ) { return a->m_count > b->m_count; } );
+
+    std::ostringstream out;
+    for ( size_t i = 0; i < count; ++i )
+    {
+	const Counter & c = *top[i];
+	out << ( i ? ", " : "" ) << c.m_source << " - " << c.m_count << " ("
+	    << (double)c.m_count / elapsed << "/s";
+	if ( c.m_error )
+	    out << ", error " << c.m_error;
+	out << ")";
+    }
+
+    m_heap.clear();
+    m_index.clear();
+
+    std::unique_ptr<Issue> summary( new ers::TopSources( ERS_HERE, count, elapsed, out.str() ) );
+    summary->set_severity( issue.severity() );
+    return summary;
+}
+
+/** Write method
+  * counts the issue source and passes the issue to the next stream. If the current interval is over
+  * the summary of this interval is passed to the next stream before the issue.
+  * \param issue issue to be sent.
+  */
+void
+ers::TopKStream::write( const Issue & issue )
+{
+    const ers::Context & context = issue.context();
+    uint64_t key = ( ers::IssueFactory::type_id( issue.get_class_name() ) * 31
+		   + ers::IssueFactory::type_id( context.file_name() ) ) * 31 + context.line_number();
+
+    std::unique_ptr<Issue> summary;
+    {
+	std::scoped_lock lock( m_mutex );
+	std::time_t time = issue.time_t();
+	if ( !m_start )
+	{
+	    m_start = time;
+	}
+	else if ( time >= m_start + (std::time_t)m_interval )
+	{
+	    if ( !m_heap.empty() )
+		summary = report( issue, time - m_start );
+	    m_start = time;
+	}
+	count( key, issue );
+    }
+
+    if ( summary )
+    {
+	chained().write( *summary );
+    }
+    chained().write( issue );
+}
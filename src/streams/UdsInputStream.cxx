@@ -0,0 +1,133 @@
+/*
+ *  UdsInputStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <memory>
+#include <vector>
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/UdsInputStream.h>
+#include <ers/internal/UdsStream.h>
+
+ERS_REGISTER_INPUT_STREAM( ers::UdsInputStream, "uds", params )
+
+namespace
+{
+    const int ReceiveBufferSize = 8 << 20;
+}
+
+/** Constructor that creates the socket at the given path. A socket file, which has been left
+  * by a previous collector, is removed.
+  * \param params path of the socket
+  */
+ers::UdsInputStream::UdsInputStream( const std::initializer_list<std::string> & params )
+  : m_path( params.size() ? *params.begin() : std::string() ),
+    m_fd( -1 ),
+    m_wakeup( -1 )
+{
+    struct sockaddr_un address;
+    ::memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    if ( m_path.empty() || m_path.size() >= sizeof( address.sun_path ) )
+    {
+	throw ers::CantOpenFile( ERS_HERE, m_path.c_str() );
+    }
+    ::strcpy( address.sun_path, m_path.c_str() );
+
+    ::unlink( m_path.c_str() );
+    m_fd = ::socket( AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0 );
+    if ( m_fd < 0 || ::bind( m_fd, reinterpret_cast<struct sockaddr *>( &address ), sizeof( address ) ) < 0 )
+    {
+	if ( m_fd >= 0 )
+	    ::close( m_fd );
+	throw ers::CantOpenFile( ERS_HERE, m_path.c_str() );
+    }
+
+    int size = ReceiveBufferSize;
+    ::setsockopt( m_fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof( size ) );
+
+    m_wakeup = ::eventfd( 0, EFD_CLOEXEC );
+    if ( m_wakeup < 0 )
+    {
+	::close( m_fd );
+	::unlink( m_path.c_str() );
+	throw ers::CantOpenFile( ERS_HERE, m_path.c_str() );
+    }
+}
+
+ers::UdsInputStream::~UdsInputStream()
+{
+    if ( m_thread.joinable() )
+    {
+	uint64_t value = 1;
+	while ( ::write( m_wakeup, &value, sizeof( value ) ) < 0 && errno == EINTR )
+	    ;
+	m_thread.join();
+    }
+
+    ::close( m_wakeup );
+    ::close( m_fd );
+    ::unlink( m_path.c_str() );
+}
+
+void
+ers::UdsInputStream::start()
+{
+    if ( !m_thread.joinable() )
+    {
+	m_thread = std::thread( &UdsInputStream::run, this );
+    }
+}
+
+/** Receives datagrams and delivers the issues they contain until the stream is destroyed.
+  */
+void
+ers::UdsInputStream::run()
+{
+    // a single frame may exceed the batch size, the sender can not send more than its socket buffer
+    std::vector<char> buffer( 4 * UdsStream::MaxDatagramSize );
+    struct pollfd fds[2] = { { m_fd, POLLIN, 0 }, { m_wakeup, POLLIN, 0 } };
+
+    while ( true )
+    {
+	if ( ::poll( fds, 2, -1 ) < 0 )
+	{
+	    if ( errno == EINTR )
+		continue;
+	    ERS_INTERNAL_ERROR( "Receiving from the \"" << m_path << "\" socket failed: " << ::strerror( errno ) )
+	    return;
+	}
+
+	if ( fds[1].revents )
+	    return;
+
+	ssize_t n = ::recv( m_fd, buffer.data(), buffer.size(), MSG_DONTWAIT );
+	if ( n <= 0 )
+	    continue;
+
+	for ( const char * p = buffer.data(), * end = p + n; p < end; )
+	{
+	    std::unique_ptr<Issue> issue( codec::decode_binary( p, end ) );
+	    if ( !issue )
+	    {
+		if ( !codec::binary_frame_size( p, end ) )
+		    break;
+		continue;
+	    }
+	    receive( *issue );
+	}
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ *  UdsStream.cxx
+ *  ers
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ers/SampleIssues.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/UdsStream.h>
+
+ERS_REGISTER_OUTPUT_STREAM( ers::UdsStream, "uds", path )
+
+namespace
+{
+    const std::chrono::milliseconds FlushInterval( 10 );
+}
+
+/** Constructor that creates a non-blocking socket for sending issues to the given address.
+  * The collector does not have to be running at this moment.
+  * \param path path of the collector socket
+  */
+ers::UdsStream::UdsStream( const std::string & path )
+  : m_dropped( 0 ),
+    m_frames( 0 ),
+    m_terminated( false )
+{
+    ::memset( &m_address, 0, sizeof( m_address ) );
+    m_address.sun_family = AF_UNIX;
+    if ( path.empty() || path.size() >= sizeof( m_address.sun_path ) )
+    {
+	throw ers::CantOpenFile( ERS_HERE, path.c_str() );
+    }
+    ::strcpy( m_address.sun_path, path.c_str() );
+
+    m_fd = ::socket( AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    if ( m_fd < 0 )
+    {
+	throw ers::CantOpenFile( ERS_HERE, path.c_str() );
+    }
+
+    int size = 4 * MaxDatagramSize;
+    ::setsockopt( m_fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof( size ) );
+
+    m_batch.reserve( MaxDatagramSize );
+    m_flusher = std::thread( &UdsStream::run, this );
+}
+
+ers::UdsStream::~UdsStream()
+{
+    {
+	std::scoped_lock lock( m_mutex );
+	m_terminated = true;
+    }
+    m_condition.notify_one();
+    m_flusher.join();
+
+    {
+	// the flusher may exit without sending the frames written after its last wake up
+	std::scoped_lock lock( m_mutex );
+	flush();
+    }
+
+    if ( m_dropped )
+    {
+	ERS_INTERNAL_WARNING( m_dropped << " issues could not be sent to the \""
+		<< m_address.sun_path << "\" socket and have been dropped" )
+    }
+    ::close( m_fd );
+}
+
+/** Sends the current batch as a single datagram. This function must be called with the mutex being locked.
+  */
+void
+ers::UdsStream::flush()
+{
+    if ( !m_frames )
+	return;
+
+    ssize_t n;
+    do
+    {
+	n = ::sendto( m_fd, m_batch.data(), m_batch.size(), MSG_NOSIGNAL,
+		reinterpret_cast<const struct sockaddr *>( &m_address ), sizeof( m_address ) );
+    }
+    while ( n < 0 && errno == EINTR );
+
+    if ( n < 0 )
+    {
+	m_dropped += m_frames;
+    }
+
+    m_batch.clear();
+    m_frames = 0;
+}
+
+void
+ers::UdsStream::run()
+{
+    std::unique_lock lock( m_mutex );
+    while ( !m_terminated )
+    {
+	m_condition.wait_for( lock, FlushInterval );
+	flush();
+    }
+}
+
+/** Write method
+  * appends the binary frame of the issue to the current batch, which is sent if it can not accommodate
+  * more frames. The batch is also sent for fatal issues, since the application may be terminated
+  * right after reporting them.
+  * \param issue issue to be sent.
+  */
+void
+ers::UdsStream::write( const Issue & issue )
+{
+    std::string frame;
+    codec::encode_binary( issue, frame );
+
+    {
+	std::scoped_lock lock( m_mutex );
+	if ( m_batch.size() + frame.size() > MaxDatagramSize )
+	{
+	    flush();
+	}
+
+	m_batch += frame;
+	++m_frames;
+
+	if ( m_batch.size() >= MaxDatagramSize || issue.severity() == ers::Fatal )
+	{
+	    flush();
+	}
+    }
+
+    chained().write( issue );
+}
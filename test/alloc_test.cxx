@@ -0,0 +1,258 @@
+/*
+ *  alloc_test.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+#include <ers/OutputStream.h>
+#include <ers/StreamFactory.h>
+#include <ers/ers.h>
+
+ERS_DECLARE_ISSUE(	alloc_test,
+			Problem,
+			"problem number " << number << " has been detected",
+			((int)number) )
+
+namespace
+{
+    std::atomic<bool>	g_counting( false );
+    std::atomic<size_t>	g_allocations( 0 );
+    std::atomic<size_t>	g_bytes( 0 );
+
+    inline void count( size_t size )
+    {
+	if ( g_counting.load( std::memory_order_relaxed ) )
+	{
+	    g_allocations.fetch_add( 1, std::memory_order_relaxed );
+	    g_bytes.fetch_add( size, std::memory_order_relaxed );
+	}
+    }
+}
+
+#ifdef __GLIBC__
+/* The malloc functions of this executable interpose the ones of the C library for all the loaded modules,
+ * so the allocations done by the ERS library and by the C++ operator new are counted as well.
+ */
+extern "C"
+{
+    void * __libc_malloc( size_t size );
+    void * __libc_calloc( size_t number, size_t size );
+    void * __libc_realloc( void * pointer, size_t size );
+
+    void * malloc( size_t size )
+    {
+	count( size );
+	return __libc_malloc( size );
+    }
+
+    void * calloc( size_t number, size_t size )
+    {
+	count( number * size );
+	return __libc_calloc( number, size );
+    }
+
+    void * realloc( void * pointer, size_t size )
+    {
+	count( size );
+	return __libc_realloc( pointer, size );
+    }
+}
+#else
+void * operator new( size_t size )
+{
+    count( size );
+    if ( void * pointer = std::malloc( size ? size : 1 ) )
+	return pointer;
+    throw std::bad_alloc();
+}
+
+void * operator new[]( size_t size )
+{
+    return operator new( size );
+}
+#endif
+
+namespace
+{
+    const int Iterations = 1000;
+
+    struct Limit
+    {
+	double	m_allocations;	/**< \brief maximum number of allocations per call */
+	double	m_bytes;	/**< \brief maximum number of allocated bytes per call */
+    };
+
+    int g_failures = 0;
+
+    /** Returns the limit for a call, which does the given average number of allocations of the given total size
+      * per call in the current implementation. The values were measured with both the debug and the release
+      * builds on x86_64 Linux, where they are the same. The limit allows two more allocations and twice as many
+      * bytes plus 512, since the sizes depend on the lengths of the host name, user name, paths and on the depth
+      * of the recorded stack. The calls, which do not allocate, must stay allocation free, so they get no headroom.
+      */
+    Limit measured( double allocations, double bytes )
+    {
+	return Limit{ allocations ? allocations + 2 : 0, bytes ? 2 * bytes + 512 : 0 };
+    }
+
+    /** Calls the function once to initialize all the caches, then counts the allocations done by
+      * the given number of subsequent calls and compares the average values with the limit.
+      */
+    template <class F>
+    void check( const std::string & name, Limit limit, F function, int iterations = Iterations )
+    {
+	function( -1 );
+
+	g_allocations = 0;
+	g_bytes = 0;
+	g_counting = true;
+	for ( int i = 0; i < iterations; ++i )
+	{
+	    function( i );
+	}
+	g_counting = false;
+
+	double allocations = double( g_allocations ) / iterations;
+	double bytes = double( g_bytes ) / iterations;
+	bool passed = allocations <= limit.m_allocations && bytes <= limit.m_bytes;
+	if ( !passed )
+	{
+	    ++g_failures;
+	}
+
+	std::clog << ( passed ? "passed " : "FAILED " ) << name << ": "
+		  << allocations << " allocations (limit " << limit.m_allocations << "), "
+		  << bytes << " bytes (limit " << limit.m_bytes << ") per call" << std::endl;
+    }
+
+    void check_stream( const std::string & format, Limit limit )
+    {
+	std::unique_ptr<ers::OutputStream> stream( ers::StreamFactory::instance().create_out_stream( format ) );
+	if ( !stream )
+	{
+	    ++g_failures;
+	    std::clog << "FAILED stream " << format << ": can not be created" << std::endl;
+	    return;
+	}
+
+	alloc_test::Problem issue( ERS_HERE, 1 );
+	issue.set_severity( ers::Error );
+	check( "stream " + format, limit, [&]( int ) { stream->write( issue ); } );
+    }
+
+    /** Restores the standard streams and removes the files and the shared memory segment created by the stream
+      * checks, also if one of the checks throws.
+      */
+    struct Cleanup
+    {
+	~Cleanup()
+	{
+	    std::cout.rdbuf( m_out );
+	    std::cerr.rdbuf( m_err );
+	    std::error_code error;
+	    std::filesystem::remove_all( m_dir, error );
+	    ::shm_unlink( ( '/' + m_shm ).c_str() );
+	}
+
+	std::filesystem::path	m_dir;
+	std::string		m_shm;
+	std::streambuf *	m_out;
+	std::streambuf *	m_err;
+    };
+}
+
+/** This program counts heap allocations done by the ERS reporting functions and by the built-in streams
+  * and fails if any of them exceeds its limit. The limits are derived from the values measured for the current
+  * implementation (see measured()), so a change which adds heap allocations to the reporting path is detected.
+  * The abort, exit and throw streams are not checked since they do not return to the caller.
+  */
+int main( int , char ** )
+{
+    setenv( "TDAQ_ERS_DEBUG_LEVEL", "1", 1 );
+    setenv( "TDAQ_ERS_DEBUG", "null", 1 );
+    setenv( "TDAQ_ERS_LOG", "null", 1 );
+    setenv( "TDAQ_ERS_INFO", "null", 1 );
+    setenv( "TDAQ_ERS_WARNING", "null", 1 );
+    setenv( "TDAQ_ERS_ERROR", "null", 1 );
+
+    check( "ERS_DEBUG disabled", measured( 0, 0 ), []( int i ) { ERS_DEBUG( 2, "debug message " << i ); } );
+    check( "ERS_DEBUG enabled", measured( 4, 792 ), []( int i ) { ERS_DEBUG( 1, "debug message " << i ); } );
+    check( "ERS_LOG", measured( 4, 792 ), []( int i ) { ERS_LOG( "log message " << i ); } );
+    check( "ers::warning", measured( 9, 1531 ), []( int i ) { ers::warning( alloc_test::Problem( ERS_HERE, i ) ); } );
+
+    {
+	std::atomic<int> caught( 0 );
+	std::unique_ptr<ers::IssueCatcherHandler> handler(
+		ers::set_issue_catcher( [&caught]( const ers::Issue & ) { ++caught; } ) );
+	int expected = 0;
+	check( "ers::error with catcher", measured( 10.1, 1603 ), [&]( int i )
+	{
+	    ers::error( alloc_test::Problem( ERS_HERE, i ) );
+	    for ( ++expected; caught < expected; )
+		std::this_thread::yield();
+	} );
+    }
+
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / ( "ers_alloc_test." + std::to_string( getpid() ) );
+    std::string shm = "ers_alloc_test." + std::to_string( getpid() );
+    std::filesystem::create_directories( dir );
+
+    std::ofstream null( "/dev/null" );
+    try
+    {
+	Cleanup cleanup{ dir, shm, std::cout.rdbuf( null.rdbuf() ), std::cerr.rdbuf( null.rdbuf() ) };
+
+	check_stream( "null", measured( 0, 0 ) );
+	check_stream( "lock", measured( 0, 0 ) );
+	check_stream( "glock", measured( 0, 0 ) );
+	check_stream( "filter(!test)", measured( 0, 0 ) );
+	check_stream( "rfilter(!test.*)", measured( 4, 233 ) );
+	check_stream( "throttle(30,30)", measured( 3.1, 83 ) );
+	check_stream( "sample(1,0.5)", measured( 7, 547 ) );
+	check_stream( "topk(10,60)", measured( 0, 0 ) );
+	check_stream( "stdout", measured( 0, 0 ) );
+	check_stream( "stderr", measured( 0, 0 ) );
+	check_stream( "lstdout", measured( 0, 0 ) );
+	check_stream( "lstderr", measured( 0, 0 ) );
+	check_stream( "fstdout(severity,time,position,parameters)", measured( 5, 259 ) );
+	check_stream( "lfstderr(severity,time,position,parameters)", measured( 5, 259 ) );
+	check_stream( "file(" + ( dir / "file.log" ).string() + ")", measured( 0, 0 ) );
+	check_stream( "lfile(" + ( dir / "lfile.log" ).string() + ")", measured( 0, 0 ) );
+	check_stream( "ffile(" + ( dir / "ffile.log" ).string() + ",severity,time,position)", measured( 5, 259 ) );
+	check_stream( "lffile(" + ( dir / "lffile.log" ).string() + ",severity,time,position)", measured( 5, 259 ) );
+	check_stream( "rfile(" + ( dir / "rfile.log" ).string() + ")", measured( 2, 651 ) );
+	check_stream( "dfile(" + ( dir / "dfile.log" ).string() + ")", measured( 4, 707 ) );
+	check_stream( "bfile(" + ( dir / "file.bin" ).string() + ")", measured( 6, 1896 ) );
+	check_stream( "jfile(" + ( dir / "file.json" ).string() + ")", measured( 7, 3817 ) );
+	check_stream( "shm(" + shm + ")", measured( 0, 0 ) );
+	check_stream( "uds(" + ( dir / "collector.sock" ).string() + ")", measured( 6, 1896 ) );
+	check_stream( "tee(null|null)", measured( 2.1, 128 ) );
+    }
+    catch( std::exception & ex )
+    {
+	++g_failures;
+	std::clog << "FAILED stream checks: " << ex.what() << std::endl;
+    }
+
+    if ( g_failures )
+    {
+	std::clog << g_failures << " check(s) have failed" << std::endl;
+	return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ *  codec_test.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ers/ers.h>
+#include <ers/internal/IssueCodec.h>
+#include <ers/internal/Symbolizer.h>
+
+ERS_DECLARE_ISSUE(	codec_test,
+			Problem,
+			"problem number " << number << " has been detected",
+			((int)number) )
+
+namespace
+{
+    int g_failures = 0;
+
+    void check( bool condition, const std::string & name )
+    {
+	if ( !condition )
+	{
+	    ++g_failures;
+	}
+	std::clog << ( condition ? "passed " : "FAILED " ) << name << std::endl;
+    }
+
+    bool equal( const std::vector<ers::Frame> & a, const std::vector<ers::Frame> & b )
+    {
+	if ( a.size() != b.size() )
+	    return false;
+	for ( size_t i = 0; i < a.size(); ++i )
+	{
+	    if (    a[i].m_module != b[i].m_module
+		 || a[i].m_build_id != b[i].m_build_id
+		 || a[i].m_offset != b[i].m_offset )
+		return false;
+	}
+	return true;
+    }
+
+    /** Runs the ers_symbolize utility for the given file and returns its output. */
+    std::string symbolize( const std::string & utility, const std::string & path )
+    {
+	std::string output;
+	if ( FILE * pipe = ::popen( ( utility + " " + path ).c_str(), "r" ) )
+	{
+	    char buf[4096];
+	    for ( size_t size; ( size = ::fread( buf, 1, sizeof( buf ), pipe ) ); )
+		output.append( buf, size );
+	    ::pclose( pipe );
+	}
+	return output;
+    }
+}
+
+/** The stack of this issue starts in this function, which must be found by ers_symbolize. */
+__attribute__((noinline)) codec_test::Problem * codec_test_origin( int number )
+{
+    return new codec_test::Problem(
+	ers::LocalContext( ERS_PACKAGE, __FILE__, __LINE__, __PRETTY_FUNCTION__, true ), number );
+}
+
+/** This program checks that the stack frames of an issue survive the binary and JSON encoding and
+  * that the decoded frames are resolved by the ers_symbolize utility, whose path is given as the argument.
+  */
+int main( int argc, char ** argv )
+{
+    if ( argc < 2 )
+    {
+	std::cerr << "Usage: codec_test <ers_symbolize>" << std::endl;
+	return 1;
+    }
+
+    std::unique_ptr<ers::Issue> issue( codec_test_origin( 1 ) );
+    std::vector<ers::Frame> frames = issue->context().frames();
+    check( !frames.empty(), "local context has stack frames" );
+
+    std::string binary;
+    ers::codec::encode_binary( *issue, binary );
+    const char * data = binary.data();
+    std::unique_ptr<ers::Issue> from_binary( ers::codec::decode_binary( data, binary.data() + binary.size() ) );
+    check( from_binary && equal( from_binary->context().frames(), frames ), "binary round trip" );
+
+    std::string json;
+    ers::codec::encode_json( *issue, json );
+    std::unique_ptr<ers::Issue> from_json( ers::codec::decode_json( json ) );
+    check( from_json && equal( from_json->context().frames(), frames ), "JSON round trip" );
+
+    check( !ers::codec::decode_binary( data = binary.data(), binary.data() + binary.size() - 1 ),
+	"truncated binary frame is rejected" );
+
+    if ( from_binary )
+    {
+	std::string path = "/tmp/ers_codec_test." + std::to_string( getpid() );
+	{
+	    std::ofstream out( path );
+	    for ( const std::string & frame : from_binary->context().stack() )
+		out << frame << std::endl;
+	}
+	std::string output = symbolize( argv[1], path );
+	::unlink( path.c_str() );
+	check( output.find( "codec_test_origin" ) != std::string::npos, "decoded frames are symbolized" );
+    }
+
+    if ( g_failures )
+    {
+	std::clog << g_failures << " check(s) failed" << std::endl;
+	return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ *  format_benchmark.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <ers/OutputStream.h>
+#include <ers/StreamManager.h>
+#include <ers/ers.h>
+
+ERS_DECLARE_ISSUE( bench,
+		   StreamedIssue,
+		   "can not read " << size << " bytes from the \"" << name << "\" file at " << offset,
+		   ((std::string)name)
+		   ((long)size)
+		   ((double)offset) )
+
+ERS_DECLARE_ISSUE_FMT( bench,
+		   FormattedIssue,
+		   "can not read {1} bytes from the \"{0}\" file at {2}",
+		   ((std::string)name)
+		   ((long)size)
+		   ((double)offset) )
+
+namespace
+{
+    /** This stream requests the message text of every issue, which forces the message to be formatted,
+      * and counts the total length of the messages.
+      */
+    struct CountingStream : public ers::OutputStream
+    {
+	void write( const ers::Issue & issue ) override
+	{ m_length += issue.message().size(); }
+
+	size_t m_length = 0;
+    };
+
+    template <class F>
+    void measure( const char * name, int iterations, F f )
+    {
+	auto start = std::chrono::steady_clock::now();
+	for ( int i = 0; i < iterations; ++i )
+	{
+	    f( i );
+	}
+	auto time = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start );
+	std::cout << name << ": " << time.count() / iterations << " ns per message" << std::endl;
+    }
+}
+
+/** This program compares the performance of the stream based and the format string based
+  * message construction. The issues are reported to the LOG stream, which must be configured
+  * to discard them, e.g. TDAQ_ERS_LOG=null, so only the message formatting is measured.
+  */
+int main( int ac, char ** av )
+{
+    int iterations = ac > 1 ? atoi( av[1] ) : 1000000;
+
+    // the first issue triggers the LOG stream initialization, which would replace the counting stream
+    ERS_LOG( "starting benchmark with " << iterations << " iterations" );
+
+    CountingStream * counter = new CountingStream;
+    ers::StreamManager::instance().add_output_stream( ers::Log, counter );
+
+    std::string name( "/tmp/data.raw" );
+    measure( "ERS_LOG ", iterations, [&]( int i )
+	{ ERS_LOG( "read " << i << " bytes from the \"" << name << "\" file in " << i * 0.001 << " seconds" ); } );
+    measure( "ERS_LOGF", iterations, [&]( int i )
+	{ ERS_LOGF( "read {} bytes from the \"{}\" file in {} seconds", i, name, i * 0.001 ); } );
+
+    measure( "streamed issue ", iterations, [&]( int i )
+	{ ers::log( bench::StreamedIssue( ERS_HERE, name, i, i * 0.001 ) ); } );
+    measure( "formatted issue", iterations, [&]( int i )
+	{ ers::log( bench::FormattedIssue( ERS_HERE, name, i, i * 0.001 ) ); } );
+
+    std::cout << "total message length: " << counter->m_length << std::endl;
+    return 0;
+}
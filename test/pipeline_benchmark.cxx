@@ -0,0 +1,76 @@
+/*
+ *  pipeline_benchmark.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <stdlib.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <ers/OutputStream.h>
+#include <ers/Pipeline.h>
+#include <ers/StreamFactory.h>
+#include <ers/ers.h>
+
+namespace
+{
+    constexpr char qualifiers[] = "!test";
+
+    template <int Initial>
+    using Stream = ers::Pipeline<ers::pipeline::Throttle<Initial, 30>,
+				 ers::pipeline::Filter<qualifiers>,
+				 ers::pipeline::StdErr>;
+
+    void measure( const char * name, int iterations, ers::OutputStream & stream, const ers::Issue & issue )
+    {
+	auto start = std::chrono::steady_clock::now();
+	for ( int i = 0; i < iterations; ++i )
+	{
+	    stream.write( issue );
+	}
+	auto time = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start );
+	std::clog << name << ": " << time.count() / iterations << " ns per issue" << std::endl;
+    }
+}
+
+/** This program compares the compile time ers::Pipeline stream with the equivalent chain of streams
+  * created from the "throttle,filter(!test),lstderr" configuration. The standard error is redirected
+  * to /dev/null while measuring, so only the stream overhead and the message rendering are measured.
+  * In the "suppressed" case almost all issues are dropped by the throttling stage, in the "printed"
+  * case all of them reach the output.
+  */
+int main( int argc, char ** argv )
+{
+    int iterations = argc > 1 ? atoi( argv[1] ) : 1000000;
+
+    std::ofstream null( "/dev/null" );
+    std::streambuf * err = std::cerr.rdbuf( null.rdbuf() );
+
+    ers::Message issue( ERS_HERE, "pipeline benchmark message" );
+
+    {
+	std::unique_ptr<ers::OutputStream> chain( ers::StreamFactory::instance().create_out_chain(
+		{ "throttle(30,30)", "filter(!test)", "lstderr" } ) );
+	Stream<30> pipeline;
+	measure( "suppressed, runtime chain", iterations, *chain, issue );
+	measure( "suppressed, pipeline", iterations, pipeline, issue );
+    }
+
+    {
+	std::unique_ptr<ers::OutputStream> chain( ers::StreamFactory::instance().create_out_chain(
+		{ "throttle(2000000000,30)", "filter(!test)", "lstderr" } ) );
+	Stream<2000000000> pipeline;
+	measure( "printed, runtime chain", iterations / 10, *chain, issue );
+	measure( "printed, pipeline", iterations / 10, pipeline, issue );
+    }
+
+    std::cerr.rdbuf( err );
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ *  pipeline_test.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ers/OutputStream.h>
+#include <ers/Pipeline.h>
+#include <ers/StreamFactory.h>
+#include <ers/ers.h>
+
+namespace
+{
+    constexpr char qualifiers[] = "!test";
+
+    typedef ers::Pipeline<ers::pipeline::Throttle<3,30>,
+			  ers::pipeline::Filter<qualifiers>,
+			  ers::pipeline::StdErr> Stream;
+
+    /** Writes all the issues to the stream and returns the text, which has been printed to the standard error. */
+    std::string print( ers::OutputStream & stream, const std::vector<std::unique_ptr<ers::Issue> > & issues )
+    {
+	std::ostringstream out;
+	std::streambuf * err = std::cerr.rdbuf( out.rdbuf() );
+	for ( const auto & issue : issues )
+	{
+	    stream.write( *issue );
+	}
+	std::cerr.rdbuf( err );
+	return out.str();
+    }
+}
+
+/** This program checks that the compile time ers::Pipeline stream produces the same output as the
+  * equivalent "throttle(3,30),filter(!test),lstderr" chain of streams. The issues come from several
+  * source positions, including two different files with the same line number, which must be throttled
+  * independently, and some of them are filtered out by their qualifiers.
+  */
+int main( int , char ** )
+{
+    std::vector<std::unique_ptr<ers::Issue> > issues;
+    for ( int i = 0; i < 150; ++i )
+    {
+	const char * file = i % 3 == 0 ? "first.cxx" : "second.cxx";
+	int line = i % 3 == 2 ? 20 : 10;
+	std::ostringstream message;
+	message << "message " << i;
+	issues.emplace_back( new ers::Message( ers::LocalContext( ERS_PACKAGE, file, line, "f()", false ), message.str() ) );
+	if ( i % 7 == 0 )
+	{
+	    issues.back()->add_qualifier( "test" );
+	}
+    }
+
+    std::unique_ptr<ers::OutputStream> chain( ers::StreamFactory::instance().create_out_chain(
+	    { "throttle(3,30)", "filter(!test)", "lstderr" } ) );
+    Stream pipeline;
+
+    std::string expected = print( *chain, issues );
+    std::string result = print( pipeline, issues );
+
+    bool passed = !expected.empty() && expected == result;
+    std::clog << ( passed ? "passed " : "FAILED " ) << "pipeline output equals the runtime chain output" << std::endl;
+    if ( !passed )
+    {
+	std::clog << "runtime chain:" << std::endl << expected << "pipeline:" << std::endl << result;
+	return 1;
+    }
+    return 0;
+}
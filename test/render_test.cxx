@@ -0,0 +1,92 @@
+/*
+ *  render_test.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <ers/ers.h>
+
+namespace render_test
+{
+    /** Renders the message slowly and fails on the first attempt, so a concurrent reader of the message
+      * is waiting when the renderer throws.
+      */
+    struct Renderer
+    {
+	void operator()( std::ostream & out ) const
+	{
+	    int call = m_calls++;
+	    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+	    if ( !call )
+		throw std::runtime_error( "renderer failure" );
+	    out << "rendered message";
+	}
+
+	mutable std::atomic<int> m_calls{ 0 };
+    };
+
+    class Problem : public ers::Issue
+    {
+      public:
+	Problem( const ers::Context & context, const Renderer & renderer )
+	  : ers::Issue( context )
+	{ set_message_renderer( ers::MessageRenderer( renderer ) ); }
+
+	const char * get_class_name() const override
+	{ return "render_test::Problem"; }
+
+	ers::Issue * clone() const override
+	{ return new Problem( *this ); }
+
+	void raise() const override
+	{ throw Problem( *this ); }
+    };
+}
+
+/** This program checks that a thread, which waits for the message of an issue while another thread
+  * renders it, does not hang if the renderer throws, but renders the message itself.
+  */
+int main( int , char ** )
+{
+    render_test::Renderer renderer;
+    render_test::Problem issue( ERS_HERE, renderer );
+
+    std::future<bool> first = std::async( std::launch::async, [&issue]()
+    {
+	try {
+	    issue.message();
+	}
+	catch( std::runtime_error & ) {
+	    return true;
+	}
+	return false;
+    } );
+
+    // let the first thread start rendering
+    while ( !renderer.m_calls )
+	std::this_thread::yield();
+
+    std::future<std::string> second = std::async( std::launch::async, [&issue]() { return issue.message(); } );
+
+    if ( second.wait_for( std::chrono::seconds( 10 ) ) != std::future_status::ready )
+    {
+	std::clog << "FAILED the reader hangs after the renderer has thrown" << std::endl;
+	::_Exit( 1 );
+    }
+
+    bool passed = first.get() && second.get() == "rendered message" && issue.message() == "rendered message";
+    std::clog << ( passed ? "passed " : "FAILED " ) << "message is rendered after a renderer failure" << std::endl;
+    return passed ? 0 : 1;
+}
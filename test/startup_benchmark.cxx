@@ -0,0 +1,116 @@
+/*
+ *  startup_benchmark.cxx
+ *  Test
+ *
+ *  Copyright 2026 CERN. All rights reserved.
+ *
+ */
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <ers/StreamManager.h>
+#include <ers/ers.h>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    struct Result
+    {
+	long	m_manager;	/**< \brief time of the StreamManager construction in microseconds */
+	long	m_report;	/**< \brief time of the first LOG message in microseconds */
+	bool	m_loaded;	/**< \brief is ErsBaseStreams loaded after the StreamManager construction */
+    };
+
+    long elapsed( clock_type::time_point start )
+    {
+	return std::chrono::duration_cast<std::chrono::microseconds>( clock_type::now() - start ).count();
+    }
+
+    bool is_loaded( const char * library )
+    {
+	void * handle = dlopen( library, RTLD_LAZY|RTLD_NOLOAD );
+	if ( handle )
+	{
+	    dlclose( handle );
+	}
+	return handle != 0;
+    }
+
+    /** Measures the ERS initialization in a new process, since it can be done only once per process.
+      */
+    Result measure()
+    {
+	int fds[2];
+	if ( pipe( fds ) )
+	{
+	    perror( "pipe" );
+	    exit( 1 );
+	}
+
+	pid_t pid = fork();
+	if ( pid == 0 )
+	{
+	    Result result;
+	    clock_type::time_point start = clock_type::now();
+	    ers::StreamManager::instance();
+	    result.m_manager = elapsed( start );
+	    result.m_loaded = is_loaded( "libErsBaseStreams.so" );
+
+	    start = clock_type::now();
+	    ERS_LOG( "startup benchmark" );
+	    result.m_report = elapsed( start );
+
+	    if ( write( fds[1], &result, sizeof( result ) ) != sizeof( result ) )
+	    {
+		_exit( 1 );
+	    }
+	    _exit( 0 );
+	}
+
+	Result result = { -1, -1, false };
+	if ( read( fds[0], &result, sizeof( result ) ) != sizeof( result ) )
+	{
+	    std::cerr << "child process failed" << std::endl;
+	}
+	waitpid( pid, 0, 0 );
+	close( fds[0] );
+	close( fds[1] );
+	return result;
+    }
+}
+
+/** This program measures how long it takes to initialize ERS in a new process
+  * and to report the first message. The LOG stream is set to "null" unless
+  * the TDAQ_ERS_LOG environment variable is already defined.
+  */
+int main( int argc, char ** argv )
+{
+    int iterations = argc > 1 ? atoi( argv[1] ) : 20;
+
+    setenv( "TDAQ_ERS_LOG", "null", 0 );
+
+    long manager = 0;
+    long report = 0;
+    bool loaded = false;
+    for ( int i = 0; i < iterations; ++i )
+    {
+	Result result = measure();
+	manager += result.m_manager;
+	report += result.m_report;
+	loaded = loaded || result.m_loaded;
+    }
+
+    std::cout << "StreamManager construction: " << manager / iterations << " us" << std::endl;
+    std::cout << "first LOG message: " << report / iterations << " us" << std::endl;
+    std::cout << "stream libraries loaded by the StreamManager construction: " << ( loaded ? "yes" : "no" ) << std::endl;
+
+    return 0;
+}